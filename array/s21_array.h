@@ -4,10 +4,17 @@
 #include <initializer_list>
 #include <iostream>
 
+#include "../memory/s21_relocate.h"
+#include "../simd/s21_simd.h"
+
 namespace s21 {
 
-template <typename T, size_t S>
+// Alignment задаёт выравнивание Data(), например 32 или 64 для AVX
+template <typename T, size_t S, size_t Alignment = alignof(T)>
 class Array {
+  static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                "Alignment must be a power of two not less than alignof(T)");
+
  public:
   using valueType = T;
   using reference = T &;
@@ -23,7 +30,7 @@ class Array {
   ~Array();
 
   Array &operator=(Array &&a) noexcept;
-  Array &operator=(const Array<T, S> &a);
+  Array &operator=(const Array &a);
 
   constexpr reference At(sizeType pos);
   constexpr reference operator[](sizeType pos) noexcept;
@@ -45,7 +52,7 @@ class Array {
   void Fill(constReference value);
 
  private:
-  valueType arr_[S ? S : 1] = {};
+  alignas(Alignment) valueType arr_[S ? S : 1] = {};
 };
 }  // namespace s21
 
@@ -4,57 +4,46 @@
 
 namespace s21 {
 
-template <typename T, size_t S>
-Array<T, S>::Array() = default;
+template <typename T, size_t S, size_t Alignment>
+Array<T, S, Alignment>::Array() = default;
 
-template <typename T, size_t S>
-Array<T, S>::Array(std::initializer_list<valueType> const &items) {
-  for (size_t i = 0; i < items.size(); ++i) {
-    arr_[i] = items.begin()[i];
-  }
+template <typename T, size_t S, size_t Alignment>
+Array<T, S, Alignment>::Array(std::initializer_list<valueType> const &items) {
+  CopyAssign(items.begin(), items.begin() + std::min(items.size(), S), arr_);
 }
 
-template <typename T, size_t S>
-Array<T, S>::Array(const Array<T, S> &a) {
-  for (size_t i = 0; i < S; ++i) {
-    arr_[i] = a.arr_[i];
-  }
+template <typename T, size_t S, size_t Alignment>
+Array<T, S, Alignment>::Array(const Array &a) {
+  CopyAssign(a.arr_, a.arr_ + S, arr_);
 }
 
-template <typename T, size_t S>
-Array<T, S>::Array(Array<T, S> &&a) noexcept {
-  if (this != &a) {
-    for (size_t i = 0; i < S; ++i) {
-      arr_[i] = std::move(a.arr_[i]);
-    }
-  }
+template <typename T, size_t S, size_t Alignment>
+Array<T, S, Alignment>::Array(Array &&a) noexcept {
+  MoveAssign(a.arr_, a.arr_ + S, arr_);
 }
 
-template <typename T, size_t S>
-Array<T, S>::~Array() = default;
+template <typename T, size_t S, size_t Alignment>
+Array<T, S, Alignment>::~Array() = default;
 
-template <typename T, size_t S>
-Array<T, S> &Array<T, S>::operator=(Array<T, S> &&a) noexcept {
+template <typename T, size_t S, size_t Alignment>
+Array<T, S, Alignment> &Array<T, S, Alignment>::operator=(Array &&a) noexcept {
   if (this != &a) {
-    for (size_t i = 0; i < S; ++i) {
-      arr_[i] = std::move(a.arr_[i]);
-    }
+    MoveAssign(a.arr_, a.arr_ + S, arr_);
   }
   return *this;
 }
 
-template <typename T, size_t S>
-Array<T, S> &Array<T, S>::operator=(const Array<T, S> &a) {
+template <typename T, size_t S, size_t Alignment>
+Array<T, S, Alignment> &Array<T, S, Alignment>::operator=(const Array &a) {
   if (this != &a) {
-    for (size_t i = 0; i < S; ++i) {
-      arr_[i] = a.arr_[i];
-    }
+    CopyAssign(a.arr_, a.arr_ + S, arr_);
   }
   return *this;
 }
 
-template <typename T, size_t S>
-constexpr typename Array<T, S>::reference Array<T, S>::At(sizeType pos) {
+template <typename T, size_t S, size_t Alignment>
+constexpr typename Array<T, S, Alignment>::reference
+Array<T, S, Alignment>::At(sizeType pos) {
   if (pos >= S) {
     throw std::out_of_range(
         "array::At(): index (which is " + std::to_string(pos) +
@@ -63,79 +52,88 @@ constexpr typename Array<T, S>::reference Array<T, S>::At(sizeType pos) {
   return arr_[pos];
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::reference constexpr Array<T, S>::operator[](
-    sizeType pos) noexcept {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::reference constexpr
+Array<T, S, Alignment>::operator[](sizeType pos) noexcept {
   return arr_[pos];
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::constReference constexpr Array<T, S>::Front() noexcept {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::constReference constexpr
+Array<T, S, Alignment>::Front() noexcept {
   return arr_[0];
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::constReference constexpr Array<T, S>::Back() noexcept {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::constReference constexpr
+Array<T, S, Alignment>::Back() noexcept {
   return arr_[S - 1];
 }
 
-template <typename T, size_t S>
-bool constexpr Array<T, S>::Empty() const noexcept {
+template <typename T, size_t S, size_t Alignment>
+bool constexpr Array<T, S, Alignment>::Empty() const noexcept {
   return S == 0;
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::sizeType constexpr Array<T, S>::Size() const noexcept {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::sizeType constexpr
+Array<T, S, Alignment>::Size() const noexcept {
   return S;
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::sizeType constexpr Array<T, S>::MaxSize() const noexcept {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::sizeType constexpr
+Array<T, S, Alignment>::MaxSize() const noexcept {
   return S;
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::iterator Array<T, S>::Data() {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::iterator Array<T, S, Alignment>::Data() {
   return arr_;
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::iterator Array<T, S>::Begin() {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::iterator Array<T, S, Alignment>::Begin() {
   return arr_;
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::iterator Array<T, S>::End() {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::iterator Array<T, S, Alignment>::End() {
   return arr_ + S;
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::constIterator Array<T, S>::Data() const {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::constIterator
+Array<T, S, Alignment>::Data() const {
   return arr_;
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::constIterator Array<T, S>::Begin() const {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::constIterator
+Array<T, S, Alignment>::Begin() const {
   return arr_;
 }
 
-template <typename T, size_t S>
-typename Array<T, S>::constIterator Array<T, S>::End() const {
+template <typename T, size_t S, size_t Alignment>
+typename Array<T, S, Alignment>::constIterator
+Array<T, S, Alignment>::End() const {
   return arr_ + S;
 }
 
-template <typename T, size_t S>
-void Array<T, S>::Swap(Array &other) {
+template <typename T, size_t S, size_t Alignment>
+void Array<T, S, Alignment>::Swap(Array &other) {
   for (iterator iter1 = Begin(), iter2 = other.Begin(); iter1 != End();
        ++iter1, ++iter2) {
     std::swap(*iter1, *iter2);
   }
 }
 
-template <typename T, size_t S>
-void Array<T, S>::Fill(constReference value) {
-  for (iterator iter = Begin(); iter != End(); ++iter) {
-    *iter = value;
+template <typename T, size_t S, size_t Alignment>
+void Array<T, S, Alignment>::Fill(constReference value) {
+  if constexpr (simd::kHasKernels<T>) {
+    simd::Fill(Begin(), End(), value);
+  } else {
+    std::fill(Begin(), End(), value);
   }
 }
 
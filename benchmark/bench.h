@@ -0,0 +1,82 @@
+#ifndef SRC_BENCHMARK_BENCH_H_
+#define SRC_BENCHMARK_BENCH_H_
+
+/*
+ * Общие утилиты бенчмарков. Каждый бенчмарк собирается из одного файла в
+ * отдельную программу, поэтому заменённые operator new/delete определены
+ * прямо здесь и считают все выделения памяти в процессе.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace s21 {
+namespace bench {
+
+inline std::atomic<size_t> allocations{0};
+
+struct Result {
+  double ns_per_op;
+  double allocs_per_op;
+};
+
+// Запускает fn ops раз и возвращает среднее время и число выделений
+template <typename Function>
+Result Measure(size_t ops, Function fn) {
+  size_t allocs_before = allocations.load(std::memory_order_relaxed);
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < ops; ++i) {
+    fn(i);
+  }
+  auto finish = std::chrono::steady_clock::now();
+  size_t allocs = allocations.load(std::memory_order_relaxed) - allocs_before;
+  double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+  return {ns / ops, static_cast<double>(allocs) / ops};
+}
+
+inline void Report(const char* name, const Result& result) {
+  std::printf("%-40s %10.1f ns/op %8.2f allocs/op\n", name, result.ns_per_op,
+              result.allocs_per_op);
+}
+
+// Не даёт компилятору выбросить вычисления, результат которых не используется
+template <typename T>
+void DoNotOptimize(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+}  // namespace bench
+}  // namespace s21
+
+void* operator new(size_t size) {
+  s21::bench::allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t align) {
+  s21::bench::allocations.fetch_add(1, std::memory_order_relaxed);
+  size_t alignment = static_cast<size_t>(align);
+  size_t rounded = (size + alignment - 1) / alignment * alignment;
+  if (void* ptr = std::aligned_alloc(alignment, rounded ? rounded : alignment))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+// GCC не видит, что operator new выше тоже работает через malloc
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+#endif  // SRC_BENCHMARK_BENCH_H_
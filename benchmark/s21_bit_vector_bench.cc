@@ -0,0 +1,93 @@
+#include <cstdint>
+#include <cstdio>
+
+#include "../bit_vector/s21_bit_vector.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+constexpr size_t kBits = 1 << 26;
+constexpr size_t kQueries = 1 << 20;
+
+uint64_t NextRandom(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+// Время на 64 бита, то есть на одно слово BitVector
+void ReportPerWord(const char *name, s21::bench::Result result) {
+  result.ns_per_op /= kBits / 64;
+  s21::bench::Report(name, result);
+}
+
+}  // namespace
+
+int main() {
+  s21::Vector<bool> flags(kBits);
+  s21::BitVector bits(kBits);
+  uint64_t state = 1;
+  for (size_t i = 0; i < kBits; ++i) {
+    bool value = NextRandom(state) % 8 == 0;
+    flags[i] = value;
+    bits.Set(i, value);
+  }
+  std::printf("memory: Vector<bool> %zu MiB, BitVector %zu MiB\n",
+              flags.Capacity() >> 20, (bits.WordCount() * 8) >> 20);
+
+  ReportPerWord("Vector<bool> count", s21::bench::Measure(5, [&](size_t) {
+                 size_t count = 0;
+                 for (size_t i = 0; i < kBits; ++i) {
+                   count += flags[i];
+                 }
+                 s21::bench::DoNotOptimize(count);
+               }));
+  ReportPerWord("BitVector Count", s21::bench::Measure(20, [&](size_t) {
+                 s21::bench::DoNotOptimize(bits.Count());
+               }));
+
+  ReportPerWord("Vector<bool> scan ones", s21::bench::Measure(5, [&](size_t) {
+                 size_t last = 0;
+                 for (size_t i = 0; i < kBits; ++i) {
+                   if (flags[i]) last = i;
+                 }
+                 s21::bench::DoNotOptimize(last);
+               }));
+  ReportPerWord("BitVector FindNext", s21::bench::Measure(5, [&](size_t) {
+                 size_t last = 0;
+                 for (size_t pos = bits.FindFirst();
+                      pos != s21::BitVector::kNpos;
+                      pos = bits.FindNext(pos)) {
+                   last = pos;
+                 }
+                 s21::bench::DoNotOptimize(last);
+               }));
+
+  s21::BitVector mask(kBits, true);
+  ReportPerWord("BitVector &=", s21::bench::Measure(20, [&](size_t) {
+                 mask &= bits;
+                 s21::bench::DoNotOptimize(mask.Data());
+               }));
+
+  size_t ones = bits.Count();
+  s21::bench::Report("Rank scan (per query)",
+                     s21::bench::Measure(64, [&](size_t) {
+                       s21::bench::DoNotOptimize(
+                           bits.Rank(NextRandom(state) % kBits));
+                     }));
+  ReportPerWord("BuildRankIndex", s21::bench::Measure(5, [&](size_t) {
+                  bits.BuildRankIndex();
+                }));
+  s21::bench::Report("Rank indexed", s21::bench::Measure(kQueries, [&](size_t) {
+                       s21::bench::DoNotOptimize(
+                           bits.Rank(NextRandom(state) % kBits));
+                     }));
+  s21::bench::Report("Select indexed",
+                     s21::bench::Measure(kQueries, [&](size_t) {
+                       s21::bench::DoNotOptimize(
+                           bits.Select(NextRandom(state) % ones));
+                     }));
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../concurrent_vector/s21_concurrent_vector.h"
+#include "../thread_pool/s21_thread_pool.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+// Общее число элементов и максимальное число потоков можно передать
+// аргументами; по умолчанию потоков до 32
+constexpr size_t kDefaultElements = 1 << 22;
+constexpr size_t kDefaultThreads = 32;
+constexpr size_t kBatch = 64;
+
+// Запускает body(thread, count) в threads потоках, делящих count поровну
+template <typename Body>
+double RunThreads(size_t threads, size_t count, Body body) {
+  return s21::bench::Measure(1, [&](size_t) {
+           std::vector<std::thread> workers;
+           for (size_t t = 0; t < threads; ++t) {
+             workers.emplace_back(body, t, count / threads);
+           }
+           for (std::thread &worker : workers) worker.join();
+         }).ns_per_op /
+         static_cast<double>(count);
+}
+
+void RunWithThreads(size_t threads, size_t count) {
+  std::mutex mutex;
+  s21::Vector<uint64_t> shared;
+  double locked = RunThreads(threads, count, [&](size_t t, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      std::lock_guard<std::mutex> lock(mutex);
+      shared.PushBack(t * n + i);
+    }
+  });
+  s21::ConcurrentVector<uint64_t> pushed;
+  double push = RunThreads(threads, count, [&](size_t t, size_t n) {
+    for (size_t i = 0; i < n; ++i) pushed.PushBack(t * n + i);
+  });
+  s21::ConcurrentVector<uint64_t> grown;
+  double grow = RunThreads(threads, count, [&](size_t t, size_t n) {
+    for (size_t i = 0; i < n; i += kBatch) grown.GrowBy(kBatch, t * n + i);
+  });
+  double freeze = s21::bench::Measure(1, [&](size_t) {
+                    s21::bench::DoNotOptimize(pushed.Freeze().Size());
+                  }).ns_per_op /
+                  static_cast<double>(count);
+  std::printf("%7zu %14.2f %14.2f %14.2f %12.2f\n", threads, locked, push,
+              grow, freeze);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                          : kDefaultElements;
+  size_t max_threads =
+      argc > 2 ? std::strtoull(argv[2], nullptr, 10) : kDefaultThreads;
+  std::printf("%zu uint64_t appends, up to %zu threads (%zu cores), ns/op\n",
+              count, max_threads, s21::ThreadPool::DefaultThreads());
+  std::printf("%7s %14s %14s %14s %12s\n", "threads", "mutex+Vector",
+              "PushBack", "GrowBy(64)", "Freeze");
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    RunWithThreads(threads, count);
+  }
+  return 0;
+}
@@ -0,0 +1,140 @@
+#include <cstdint>
+
+#include "../deque/s21_deque.h"
+#include "../list/s21_list.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+constexpr size_t kElements = 1 << 20;
+// Вставка в начало Vector квадратична, поэтому для неё берём меньше
+constexpr size_t kFrontElements = 1 << 14;
+constexpr size_t kOps = 20;
+
+void ReportPerElement(const char *name, size_t elements,
+                      s21::bench::Result result) {
+  result.ns_per_op /= elements;
+  result.allocs_per_op /= elements;
+  s21::bench::Report(name, result);
+}
+
+}  // namespace
+
+int main() {
+  ReportPerElement("Deque PushBack", kElements,
+                   s21::bench::Measure(kOps, [](size_t) {
+                     s21::Deque<int64_t> d;
+                     for (size_t i = 0; i < kElements; ++i) d.PushBack(i);
+                     s21::bench::DoNotOptimize(d.Back());
+                   }));
+  // После освобождения миллиона узлов List malloc один раз склеивает их при
+  // первом крупном выделении; пусть эта цена размажется по росту Vector
+  ReportPerElement("List PushBack", kElements,
+                   s21::bench::Measure(kOps, [](size_t) {
+                     s21::List<int64_t> l;
+                     for (size_t i = 0; i < kElements; ++i) l.PushBack(i);
+                     s21::bench::DoNotOptimize(l.Back());
+                   }));
+  ReportPerElement("Vector PushBack", kElements,
+                   s21::bench::Measure(kOps, [](size_t) {
+                     s21::Vector<int64_t> v;
+                     for (size_t i = 0; i < kElements; ++i) v.PushBack(i);
+                     s21::bench::DoNotOptimize(v.Back());
+                   }));
+
+  ReportPerElement("Deque PushFront", kFrontElements,
+                   s21::bench::Measure(kOps, [](size_t) {
+                     s21::Deque<int64_t> d;
+                     for (size_t i = 0; i < kFrontElements; ++i) {
+                       d.PushFront(i);
+                     }
+                     s21::bench::DoNotOptimize(d.Front());
+                   }));
+  ReportPerElement("Vector Insert(Begin())", kFrontElements,
+                   s21::bench::Measure(kOps, [](size_t) {
+                     s21::Vector<int64_t> v;
+                     for (size_t i = 0; i < kFrontElements; ++i) {
+                       v.Insert(v.Begin(), static_cast<int64_t>(i));
+                     }
+                     s21::bench::DoNotOptimize(v.Front());
+                   }));
+  ReportPerElement("List PushFront", kFrontElements,
+                   s21::bench::Measure(kOps, [](size_t) {
+                     s21::List<int64_t> l;
+                     for (size_t i = 0; i < kFrontElements; ++i) {
+                       l.PushFront(i);
+                     }
+                     s21::bench::DoNotOptimize(l.Front());
+                   }));
+
+  // Очередь постоянной длины: в конец кладём, из начала забираем
+  ReportPerElement("Deque queue", kElements,
+                   s21::bench::Measure(kOps, [](size_t) {
+                     s21::Deque<int64_t> d;
+                     int64_t sum = 0;
+                     for (size_t i = 0; i < kElements; ++i) {
+                       d.PushBack(i);
+                       if (d.Size() > 1000) {
+                         sum += d.Front();
+                         d.PopFront();
+                       }
+                     }
+                     s21::bench::DoNotOptimize(sum);
+                   }));
+  ReportPerElement("List queue", kElements,
+                   s21::bench::Measure(kOps, [](size_t) {
+                     s21::List<int64_t> l;
+                     int64_t sum = 0;
+                     for (size_t i = 0; i < kElements; ++i) {
+                       l.PushBack(i);
+                       if (l.Size() > 1000) {
+                         sum += l.Front();
+                         l.PopFront();
+                       }
+                     }
+                     s21::bench::DoNotOptimize(sum);
+                   }));
+
+  s21::Deque<int64_t> deque;
+  s21::Vector<int64_t> vector;
+  s21::List<int64_t> list;
+  for (size_t i = 0; i < kElements; ++i) {
+    deque.PushBack(i);
+    vector.PushBack(i);
+    list.PushBack(i);
+  }
+  ReportPerElement("Deque iterator sum", kElements,
+                   s21::bench::Measure(kOps, [&](size_t) {
+                     int64_t sum = 0;
+                     for (auto it = deque.Begin(); it != deque.End(); ++it) {
+                       sum += *it;
+                     }
+                     s21::bench::DoNotOptimize(sum);
+                   }));
+  ReportPerElement("Deque ForEachBlock sum", kElements,
+                   s21::bench::Measure(kOps, [&](size_t) {
+                     int64_t sum = 0;
+                     deque.ForEachBlock(
+                         [&sum](const int64_t *first, const int64_t *last) {
+                           for (; first != last; ++first) sum += *first;
+                         });
+                     s21::bench::DoNotOptimize(sum);
+                   }));
+  ReportPerElement("Vector sum", kElements,
+                   s21::bench::Measure(kOps, [&](size_t) {
+                     const int64_t *data = vector.Data();
+                     int64_t sum = 0;
+                     for (size_t i = 0; i < kElements; ++i) sum += data[i];
+                     s21::bench::DoNotOptimize(sum);
+                   }));
+  ReportPerElement("List iterator sum", kElements,
+                   s21::bench::Measure(kOps, [&](size_t) {
+                     int64_t sum = 0;
+                     for (auto it = list.Begin(); it != list.End(); ++it) {
+                       sum += *it;
+                     }
+                     s21::bench::DoNotOptimize(sum);
+                   }));
+  return 0;
+}
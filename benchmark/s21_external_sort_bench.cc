@@ -0,0 +1,96 @@
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "../sort/s21_external_sort.h"
+#include "../sort/s21_sort.h"
+#include "../thread_pool/s21_thread_pool.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+/*
+ * Использование: s21_external_sort_bench.out [данные МиБ] [бюджет МиБ]
+ * По умолчанию 1024 МиБ ключей при бюджете 256 МиБ, то есть данные в 4 раза
+ * больше доступной сортировке памяти. Для проверки на 4x RAM передайте
+ * размер данных в четыре объёма оперативной памяти.
+ */
+
+namespace {
+
+using Key = uint64_t;
+
+uint64_t NextRandom(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+void WriteDataset(const std::string &path, size_t count) {
+  std::FILE *file = std::fopen(path.c_str(), "wb");
+  s21::Vector<Key> block(size_t{1} << 20);
+  uint64_t state = 12345;
+  for (size_t written = 0; written < count; written += block.Size()) {
+    size_t n = std::min(block.Size(), count - written);
+    for (size_t i = 0; i < n; ++i) {
+      block[i] = NextRandom(state);
+    }
+    std::fwrite(block.Data(), sizeof(Key), n, file);
+  }
+  std::fclose(file);
+}
+
+void ReportPerKey(const char *name, size_t keys, s21::bench::Result result) {
+  std::printf("%-40s %8.2f s total\n", name, result.ns_per_op / 1e9);
+  result.ns_per_op /= keys;
+  s21::bench::Report(name, result);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t data_mib = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024;
+  size_t budget_mib = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 256;
+  size_t keys = (data_mib << 20) / sizeof(Key);
+  std::string input = "/tmp/s21_external_bench_" + std::to_string(getpid());
+  std::string output = input + ".sorted";
+  WriteDataset(input, keys);
+  std::printf("%zu MiB of keys, %zu MiB budget\n", data_mib, budget_mib);
+
+  s21::ExternalSortOptions options;
+  options.memory_bytes = budget_mib << 20;
+  s21::ExternalSortStats stats;
+  ReportPerKey("ExternalSort", keys, s21::bench::Measure(1, [&](size_t) {
+                 stats = s21::ExternalSort<Key>(input, output, options);
+               }));
+  std::printf("runs %zu, merge passes %zu\n", stats.runs, stats.merge_passes);
+
+  s21::ThreadPool pool;
+  options.pool = &pool;
+  ReportPerKey("ExternalSort with pool", keys,
+               s21::bench::Measure(1, [&](size_t) {
+                 s21::ExternalSort<Key>(input, output, options);
+               }));
+
+  // Загрузка всего файла в память: возможна, только пока данные меньше RAM
+  if (argc > 3 && std::string(argv[3]) == "--in-memory") {
+    ReportPerKey("fread + Sort + fwrite", keys,
+                 s21::bench::Measure(1, [&](size_t) {
+                   s21::Vector<Key> all(keys);
+                   std::FILE *in = std::fopen(input.c_str(), "rb");
+                   size_t read = std::fread(all.Data(), sizeof(Key), keys, in);
+                   std::fclose(in);
+                   s21::Sort(all.Data(), all.Data() + read);
+                   std::FILE *out = std::fopen(output.c_str(), "wb");
+                   std::fwrite(all.Data(), sizeof(Key), read, out);
+                   std::fclose(out);
+                 }));
+  }
+
+  std::remove(input.c_str());
+  std::remove(output.c_str());
+  return 0;
+}
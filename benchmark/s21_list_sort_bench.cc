@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <list>
+#include <random>
+#include <string>
+
+#include "../list/s21_list.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+constexpr size_t kElements = 1 << 20;
+constexpr size_t kOps = 5;
+
+s21::Vector<uint64_t> RandomKeys() {
+  std::mt19937_64 gen(42);
+  s21::Vector<uint64_t> keys;
+  for (size_t i = 0; i < kElements; ++i) keys.PushBack(gen());
+  return keys;
+}
+
+void ReportPerElement(const char *name, s21::bench::Result result) {
+  result.ns_per_op /= kElements;
+  result.allocs_per_op /= kElements;
+  s21::bench::Report(name, result);
+}
+
+}  // namespace
+
+// Каждый замер заново строит список, поэтому его цену показываем отдельно
+int main() {
+  const s21::Vector<uint64_t> keys = RandomKeys();
+  const uint64_t *data = keys.Data();
+
+  ReportPerElement("List build", s21::bench::Measure(kOps, [&](size_t) {
+                     s21::List<uint64_t> l;
+                     for (size_t i = 0; i < kElements; ++i) l.PushBack(data[i]);
+                     s21::bench::DoNotOptimize(l.Back());
+                   }));
+  ReportPerElement("List build + Sort", s21::bench::Measure(kOps, [&](size_t) {
+                     s21::List<uint64_t> l;
+                     for (size_t i = 0; i < kElements; ++i) l.PushBack(data[i]);
+                     l.Sort();
+                     s21::bench::DoNotOptimize(l.Back());
+                   }));
+  ReportPerElement("std::list build + sort",
+                   s21::bench::Measure(kOps, [&](size_t) {
+                     std::list<uint64_t> l;
+                     for (size_t i = 0; i < kElements; ++i) {
+                       l.push_back(data[i]);
+                     }
+                     l.sort();
+                     s21::bench::DoNotOptimize(l.back());
+                   }));
+  // Длинные строки: перецепление не трогает значения вовсе
+  ReportPerElement("List<string> build + Sort",
+                   s21::bench::Measure(kOps, [&](size_t) {
+                     s21::List<std::string> l;
+                     for (size_t i = 0; i < kElements; ++i) {
+                       l.PushBack(std::string(40, 'a') +
+                                  std::to_string(data[i]));
+                     }
+                     l.Sort();
+                     s21::bench::DoNotOptimize(l.Back());
+                   }));
+  return 0;
+}
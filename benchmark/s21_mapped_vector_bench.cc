@@ -0,0 +1,93 @@
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../mapped_vector/s21_mapped_vector.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+constexpr size_t kRecords = 1 << 22;
+
+struct Record {
+  int64_t id;
+  double value;
+};
+
+}  // namespace
+
+int main() {
+  std::string mapped_path = "/tmp/s21_mapped_bench_" + std::to_string(getpid());
+  std::string raw_path = mapped_path + ".raw";
+
+  s21::bench::Report("Vector PushBack", s21::bench::Measure(1, [&](size_t) {
+                       s21::Vector<Record> records;
+                       for (size_t i = 0; i < kRecords; ++i) {
+                         records.PushBack({static_cast<int64_t>(i), 0.5});
+                       }
+                       s21::bench::DoNotOptimize(records.Data());
+                     }));
+  s21::bench::Report("MappedVector PushBack + Sync",
+                     s21::bench::Measure(1, [&](size_t) {
+                       std::remove(mapped_path.c_str());
+                       s21::MappedVector<Record> records(mapped_path);
+                       for (size_t i = 0; i < kRecords; ++i) {
+                         records.PushBack({static_cast<int64_t>(i), 0.5});
+                       }
+                       records.Sync();
+                     }));
+
+  // Тот же набор в виде сырого файла, который читается целиком при старте
+  {
+    s21::ConstMappedVector<Record> records(mapped_path);
+    std::FILE *raw = std::fopen(raw_path.c_str(), "wb");
+    std::fwrite(records.Data(), sizeof(Record), records.Size(), raw);
+    std::fclose(raw);
+  }
+
+  s21::bench::Report("startup: fread into Vector",
+                     s21::bench::Measure(5, [&](size_t) {
+                       s21::Vector<Record> records(kRecords);
+                       std::FILE *raw = std::fopen(raw_path.c_str(), "rb");
+                       size_t read = std::fread(records.Data(),
+                                                sizeof(Record), kRecords, raw);
+                       std::fclose(raw);
+                       s21::bench::DoNotOptimize(read);
+                     }));
+  s21::bench::Report("startup: map read-only",
+                     s21::bench::Measure(5, [&](size_t) {
+                       s21::ConstMappedVector<Record> records(mapped_path);
+                       s21::bench::DoNotOptimize(records.Size());
+                     }));
+
+  s21::bench::Report("startup + scan: fread into Vector",
+                     s21::bench::Measure(5, [&](size_t) {
+                       s21::Vector<Record> records(kRecords);
+                       std::FILE *raw = std::fopen(raw_path.c_str(), "rb");
+                       size_t read = std::fread(records.Data(),
+                                                sizeof(Record), kRecords, raw);
+                       std::fclose(raw);
+                       int64_t sum = 0;
+                       for (size_t i = 0; i < read; ++i) {
+                         sum += records[i].id;
+                       }
+                       s21::bench::DoNotOptimize(sum);
+                     }));
+  s21::bench::Report("startup + scan: map read-only",
+                     s21::bench::Measure(5, [&](size_t) {
+                       s21::ConstMappedVector<Record> records(mapped_path);
+                       records.Advise(s21::MapAdvice::kSequential);
+                       int64_t sum = 0;
+                       for (size_t i = 0; i < records.Size(); ++i) {
+                         sum += records[i].id;
+                       }
+                       s21::bench::DoNotOptimize(sum);
+                     }));
+
+  std::remove(mapped_path.c_str());
+  std::remove(raw_path.c_str());
+  return 0;
+}
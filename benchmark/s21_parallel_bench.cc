@@ -0,0 +1,68 @@
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+
+#include "../parallel/s21_parallel.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+// Размер и максимальное число потоков можно передать аргументами
+constexpr size_t kDefaultElements = 1 << 24;
+
+s21::Vector<uint64_t> MakeKeys(size_t size) {
+  s21::Vector<uint64_t> keys(size);
+  uint64_t state = 88172645463325252ULL;
+  for (size_t i = 0; i < size; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    keys[i] = state;
+  }
+  return keys;
+}
+
+void RunWithThreads(size_t threads, const s21::Vector<uint64_t>& keys,
+                    double* base_sort_ms) {
+  s21::ThreadPool pool(threads);
+  s21::Vector<uint64_t> work(keys);
+  auto sort = s21::bench::Measure(1, [&](size_t) {
+    s21::parallel::Sort(pool, work.Begin(), work.End());
+  });
+  if (threads == 1) *base_sort_ms = sort.ns_per_op / 1e6;
+
+  auto reduce = s21::bench::Measure(5, [&](size_t) {
+    s21::bench::DoNotOptimize(
+        s21::parallel::Reduce(pool, keys.Begin(), keys.End(), uint64_t{0}));
+  });
+  auto transform = s21::bench::Measure(5, [&](size_t) {
+    s21::parallel::Transform(pool, keys.Begin(), keys.End(), work.Begin(),
+                             [](uint64_t key) { return key * 31 + 7; });
+  });
+  std::printf("%7zu %12.1f %8.2fx %12.1f %12.1f\n", threads,
+              sort.ns_per_op / 1e6,
+              *base_sort_ms / (sort.ns_per_op / 1e6), reduce.ns_per_op / 1e6,
+              transform.ns_per_op / 1e6);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                          : kDefaultElements;
+  size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                : s21::ThreadPool::DefaultThreads();
+  s21::Vector<uint64_t> keys = MakeKeys(count);
+  std::printf("%zu uint64_t keys, up to %zu threads\n", count, max_threads);
+  std::printf("%7s %12s %9s %12s %12s\n", "threads", "sort ms", "speedup",
+              "reduce ms", "transform ms");
+  double base_sort_ms = 0;
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    RunWithThreads(threads, keys, &base_sort_ms);
+    if (threads * 2 > max_threads && threads != max_threads) {
+      RunWithThreads(max_threads, keys, &base_sort_ms);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,112 @@
+#include <cstdint>
+
+#include "../ragged_array/s21_ragged_array.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+// Граф смежности: kRows вершин, в среднем kDegree соседей
+constexpr size_t kRows = 1 << 18;
+constexpr size_t kDegree = 8;
+constexpr size_t kOps = 10;
+
+using Nested = s21::Vector<s21::Vector<uint32_t>>;
+using Ragged = s21::RaggedArray<uint32_t>;
+
+uint64_t NextRandom(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+// Время и выделения на одно значение
+void ReportPerValue(const char *name, size_t values,
+                    s21::bench::Result result) {
+  result.ns_per_op /= values;
+  result.allocs_per_op /= values;
+  s21::bench::Report(name, result);
+}
+
+}  // namespace
+
+int main() {
+  // Степени и соседи заранее, чтобы генератор не входил в замер
+  s21::Vector<uint32_t> degrees(kRows);
+  s21::Vector<uint32_t> neighbours;
+  uint64_t state = 31337;
+  for (size_t r = 0; r < kRows; ++r) {
+    degrees[r] = NextRandom(state) % (2 * kDegree + 1);
+    for (uint32_t i = 0; i < degrees[r]; ++i) {
+      neighbours.PushBack(NextRandom(state) % kRows);
+    }
+  }
+  size_t values = neighbours.Size();
+
+  Nested nested;
+  ReportPerValue("Vector<Vector> build", values,
+                 s21::bench::Measure(kOps, [&](size_t) {
+                   Nested built(kRows);
+                   const uint32_t *next = neighbours.Data();
+                   for (size_t r = 0; r < kRows; ++r) {
+                     for (uint32_t i = 0; i < degrees[r]; ++i) {
+                       built[r].PushBack(*next++);
+                     }
+                   }
+                   nested = std::move(built);
+                 }));
+  Ragged ragged;
+  ReportPerValue("RaggedArray build", values,
+                 s21::bench::Measure(kOps, [&](size_t) {
+                   Ragged built;
+                   const uint32_t *next = neighbours.Data();
+                   for (size_t r = 0; r < kRows; ++r) {
+                     built.AddRow();
+                     for (uint32_t i = 0; i < degrees[r]; ++i) {
+                       built.PushBack(*next++);
+                     }
+                   }
+                   built.Freeze();
+                   ragged = std::move(built);
+                 }));
+
+  // Сумма степеней соседей по всем рёбрам: обход строк и случайный доступ
+  ReportPerValue("Vector<Vector> scan", values,
+                 s21::bench::Measure(kOps, [&](size_t) {
+                   uint64_t sum = 0;
+                   for (size_t r = 0; r < kRows; ++r) {
+                     const s21::Vector<uint32_t> &row = nested.Data()[r];
+                     for (const uint32_t *it = row.Begin(); it != row.End();
+                          ++it) {
+                       sum += nested.Data()[*it].Size();
+                     }
+                   }
+                   s21::bench::DoNotOptimize(sum);
+                 }));
+  ReportPerValue("RaggedArray scan", values,
+                 s21::bench::Measure(kOps, [&](size_t) {
+                   const size_t *offsets = ragged.Offsets();
+                   uint64_t sum = 0;
+                   for (size_t r = 0; r < kRows; ++r) {
+                     Ragged::constRowSpan row = ragged[r];
+                     for (const uint32_t *it = row.Begin(); it != row.End();
+                          ++it) {
+                       sum += offsets[*it + 1] - offsets[*it];
+                     }
+                   }
+                   s21::bench::DoNotOptimize(sum);
+                 }));
+
+  ReportPerValue("Vector<Vector> copy", values,
+                 s21::bench::Measure(kOps, [&](size_t) {
+                   Nested copy(nested);
+                   s21::bench::DoNotOptimize(copy.Data());
+                 }));
+  ReportPerValue("RaggedArray copy", values,
+                 s21::bench::Measure(kOps, [&](size_t) {
+                   Ragged copy(ragged);
+                   s21::bench::DoNotOptimize(copy.Offsets());
+                 }));
+  return 0;
+}
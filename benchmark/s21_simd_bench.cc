@@ -0,0 +1,92 @@
+#include <cstdint>
+
+#include "../simd/s21_simd.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+constexpr size_t kElements = 1 << 16;
+constexpr size_t kOps = 2000;
+
+const char* IsaName(s21::simd::Isa isa) {
+  switch (isa) {
+    case s21::simd::Isa::kAvx2:
+      return "AVX2";
+    case s21::simd::Isa::kSse2:
+      return "SSE2";
+    default:
+      return "scalar";
+  }
+}
+
+// Время на один элемент, а не на вызов, чтобы типы было легко сравнить
+void ReportPerElement(const char* name, s21::bench::Result result) {
+  result.ns_per_op /= kElements;
+  s21::bench::Report(name, result);
+}
+
+template <typename T>
+void Run(const char* type) {
+  s21::Vector<T> vec(kElements);
+  for (size_t i = 0; i < kElements; ++i) {
+    vec[i] = static_cast<T>(i % 1000);
+  }
+  const T* first = vec.Data();
+  const T* last = first + vec.Size();
+  char name[64];
+
+  std::snprintf(name, sizeof(name), "Sum<%s> scalar", type);
+  ReportPerElement(name, s21::bench::Measure(kOps, [&](size_t) {
+                     s21::bench::DoNotOptimize(
+                         s21::simd::scalar::Sum(first, last));
+                   }));
+  std::snprintf(name, sizeof(name), "Sum<%s> simd", type);
+  ReportPerElement(name, s21::bench::Measure(kOps, [&](size_t) {
+                     s21::bench::DoNotOptimize(s21::simd::Sum(first, last));
+                   }));
+
+  // Искомого значения нет, поэтому Find проходит весь диапазон
+  std::snprintf(name, sizeof(name), "Find<%s> scalar", type);
+  ReportPerElement(name, s21::bench::Measure(kOps, [&](size_t) {
+                     s21::bench::DoNotOptimize(
+                         s21::simd::scalar::Find(first, last, T(5000)));
+                   }));
+  std::snprintf(name, sizeof(name), "Find<%s> simd", type);
+  ReportPerElement(name, s21::bench::Measure(kOps, [&](size_t) {
+                     s21::bench::DoNotOptimize(
+                         s21::simd::Find(first, last, T(5000)));
+                   }));
+
+  std::snprintf(name, sizeof(name), "Count<%s> scalar", type);
+  ReportPerElement(name, s21::bench::Measure(kOps, [&](size_t) {
+                     s21::bench::DoNotOptimize(
+                         s21::simd::scalar::Count(first, last, T(7)));
+                   }));
+  std::snprintf(name, sizeof(name), "Count<%s> simd", type);
+  ReportPerElement(name, s21::bench::Measure(kOps, [&](size_t) {
+                     s21::bench::DoNotOptimize(
+                         s21::simd::Count(first, last, T(7)));
+                   }));
+
+  std::snprintf(name, sizeof(name), "Max<%s> scalar", type);
+  ReportPerElement(name, s21::bench::Measure(kOps, [&](size_t) {
+                     s21::bench::DoNotOptimize(
+                         s21::simd::scalar::Max(first, last));
+                   }));
+  std::snprintf(name, sizeof(name), "Max<%s> simd", type);
+  ReportPerElement(name, s21::bench::Measure(kOps, [&](size_t) {
+                     s21::bench::DoNotOptimize(s21::simd::Max(first, last));
+                   }));
+}
+
+}  // namespace
+
+int main() {
+  std::printf("%zu elements, kernels: %s, time per element\n", kElements,
+              IsaName(s21::simd::DetectedIsa()));
+  Run<int32_t>("int32_t");
+  Run<float>("float");
+  Run<double>("double");
+  return 0;
+}
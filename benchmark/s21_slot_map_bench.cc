@@ -0,0 +1,106 @@
+#include <cstdint>
+#include <utility>
+
+#include "../map/s21_map.h"
+#include "../slot_map/s21_slot_map.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+constexpr size_t kEntities = 1 << 18;
+
+struct Entity {
+  double x;
+  double y;
+  double vx;
+  double vy;
+};
+
+using Entities = s21::SlotMap<Entity>;
+using EntityMap = s21::Map<uint32_t, Entity>;
+
+uint64_t NextRandom(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+// Случайный порядок обращений, одинаковый для обоих контейнеров
+s21::Vector<uint32_t> MakeOrder() {
+  s21::Vector<uint32_t> order(kEntities);
+  for (size_t i = 0; i < kEntities; ++i) order[i] = i;
+  uint64_t state = 99;
+  for (size_t i = kEntities - 1; i > 0; --i) {
+    std::swap(order[i], order[NextRandom(state) % (i + 1)]);
+  }
+  return order;
+}
+
+void ReportPerEntity(const char *name, s21::bench::Result result) {
+  result.ns_per_op /= kEntities;
+  result.allocs_per_op /= kEntities;
+  s21::bench::Report(name, result);
+}
+
+}  // namespace
+
+int main() {
+  s21::Vector<uint32_t> order = MakeOrder();
+
+  Entities slots;
+  s21::Vector<Entities::Handle> handles;
+  ReportPerEntity("SlotMap Insert", s21::bench::Measure(1, [&](size_t) {
+                    for (size_t i = 0; i < kEntities; ++i) {
+                      handles.PushBack(slots.Insert(Entity{1.0 * i, 0, 1, 1}));
+                    }
+                  }));
+  EntityMap map;
+  ReportPerEntity("Map Insert", s21::bench::Measure(1, [&](size_t) {
+                    for (uint32_t i = 0; i < kEntities; ++i) {
+                      map.Insert({i, Entity{1.0 * i, 0, 1, 1}});
+                    }
+                  }));
+
+  ReportPerEntity("SlotMap lookup", s21::bench::Measure(10, [&](size_t) {
+                    double sum = 0;
+                    for (size_t i = 0; i < kEntities; ++i) {
+                      sum += slots[handles[order[i]]].x;
+                    }
+                    s21::bench::DoNotOptimize(sum);
+                  }));
+  ReportPerEntity("Map lookup", s21::bench::Measure(10, [&](size_t) {
+                    double sum = 0;
+                    for (size_t i = 0; i < kEntities; ++i) {
+                      sum += map.At(order[i]).x;
+                    }
+                    s21::bench::DoNotOptimize(sum);
+                  }));
+
+  // Обновление всех сущностей: плотный массив против обхода дерева
+  ReportPerEntity("SlotMap iterate", s21::bench::Measure(10, [&](size_t) {
+                    for (Entity *it = slots.Begin(); it != slots.End(); ++it) {
+                      it->x += it->vx;
+                      it->y += it->vy;
+                    }
+                  }));
+  ReportPerEntity("Map iterate", s21::bench::Measure(10, [&](size_t) {
+                    for (auto it = map.Begin(); it != map.End(); ++it) {
+                      it->value.x += it->value.vx;
+                      it->value.y += it->value.vy;
+                    }
+                  }));
+
+  ReportPerEntity("SlotMap Erase", s21::bench::Measure(1, [&](size_t) {
+                    for (size_t i = 0; i < kEntities; ++i) {
+                      slots.Erase(handles[order[i]]);
+                    }
+                  }));
+  ReportPerEntity("Map Erase", s21::bench::Measure(1, [&](size_t) {
+                    for (size_t i = 0; i < kEntities; ++i) {
+                      map.Erase(order[i]);
+                    }
+                  }));
+  return 0;
+}
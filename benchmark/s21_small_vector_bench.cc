@@ -0,0 +1,58 @@
+#include <string>
+
+#include "../small_vector/s21_small_vector.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+constexpr size_t kOps = 1000000;
+
+// Короткоживущий вектор: создать, заполнить count элементами, прочитать
+template <typename Container>
+void FillAndSum(size_t count, size_t seed) {
+  Container vec;
+  for (size_t i = 0; i < count; ++i) {
+    vec.PushBack(static_cast<int>(seed + i));
+  }
+  long sum = 0;
+  for (auto it = vec.Begin(); it != vec.End(); ++it) {
+    sum += *it;
+  }
+  s21::bench::DoNotOptimize(sum);
+}
+
+template <typename Container>
+void FillStrings(size_t count) {
+  Container vec;
+  for (size_t i = 0; i < count; ++i) {
+    vec.EmplaceBack("short");
+  }
+  s21::bench::DoNotOptimize(vec.Size());
+}
+
+}  // namespace
+
+int main() {
+  std::printf("Short-lived vectors, %zu iterations each\n", kOps);
+  for (size_t count : {4, 8, 16, 32}) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "Vector<int> x%zu", count);
+    s21::bench::Report(name, s21::bench::Measure(kOps, [count](size_t i) {
+                         FillAndSum<s21::Vector<int>>(count, i);
+                       }));
+    std::snprintf(name, sizeof(name), "SmallVector<int, 16> x%zu", count);
+    s21::bench::Report(name, s21::bench::Measure(kOps, [count](size_t i) {
+                         FillAndSum<s21::SmallVector<int, 16>>(count, i);
+                       }));
+  }
+  s21::bench::Report("Vector<std::string> x8",
+                     s21::bench::Measure(kOps, [](size_t) {
+                       FillStrings<s21::Vector<std::string>>(8);
+                     }));
+  s21::bench::Report("SmallVector<std::string, 16> x8",
+                     s21::bench::Measure(kOps, [](size_t) {
+                       FillStrings<s21::SmallVector<std::string, 16>>(8);
+                     }));
+  return 0;
+}
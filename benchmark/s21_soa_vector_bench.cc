@@ -0,0 +1,94 @@
+#include <cstdint>
+
+#include "../simd/s21_simd.h"
+#include "../soa_vector/s21_soa_vector.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+constexpr size_t kRecords = 1 << 20;
+constexpr size_t kOps = 50;
+
+// Запись на 64 байта, из которой цикл читает только два поля
+struct Record {
+  int32_t id;
+  float price;
+  float quantity;
+  float discount;
+  int64_t created;
+  int64_t updated;
+  double weight;
+  double volume;
+  double cost;
+  int64_t flags;
+};
+static_assert(sizeof(Record) == 64, "Record should fill a cache line");
+
+using Columns = s21::SoAVector<int32_t, float, float, float, int64_t, int64_t,
+                               double, double, double, int64_t>;
+
+// Время на одну запись
+void ReportPerRecord(const char *name, s21::bench::Result result) {
+  result.ns_per_op /= kRecords;
+  s21::bench::Report(name, result);
+}
+
+}  // namespace
+
+int main() {
+  s21::Vector<Record> records(kRecords);
+  for (size_t i = 0; i < kRecords; ++i) {
+    records[i] = Record{};
+    records[i].id = static_cast<int32_t>(i);
+    records[i].price = static_cast<float>(i % 100);
+    records[i].quantity = static_cast<float>(i % 7);
+  }
+  Columns columns = Columns::FromRecords(
+      records, &Record::id, &Record::price, &Record::quantity,
+      &Record::discount, &Record::created, &Record::updated, &Record::weight,
+      &Record::volume, &Record::cost, &Record::flags);
+
+  ReportPerRecord("AoS price*quantity",
+                  s21::bench::Measure(kOps, [&](size_t) {
+                    float total = 0;
+                    for (size_t i = 0; i < kRecords; ++i) {
+                      total += records[i].price * records[i].quantity;
+                    }
+                    s21::bench::DoNotOptimize(total);
+                  }));
+  ReportPerRecord("SoA price*quantity",
+                  s21::bench::Measure(kOps, [&](size_t) {
+                    const float *price = columns.Data<1>();
+                    const float *quantity = columns.Data<2>();
+                    float total = 0;
+                    for (size_t i = 0; i < kRecords; ++i) {
+                      total += price[i] * quantity[i];
+                    }
+                    s21::bench::DoNotOptimize(total);
+                  }));
+
+  ReportPerRecord("AoS sum(price)", s21::bench::Measure(kOps, [&](size_t) {
+                    float total = 0;
+                    for (size_t i = 0; i < kRecords; ++i) {
+                      total += records[i].price;
+                    }
+                    s21::bench::DoNotOptimize(total);
+                  }));
+  ReportPerRecord("SoA simd::Sum(price)",
+                  s21::bench::Measure(kOps, [&](size_t) {
+                    const float *price = columns.Data<1>();
+                    s21::bench::DoNotOptimize(
+                        s21::simd::Sum(price, price + kRecords));
+                  }));
+
+  ReportPerRecord("AoS -> SoA FromRecords",
+                  s21::bench::Measure(5, [&](size_t) {
+                    s21::bench::DoNotOptimize(Columns::FromRecords(
+                        records, &Record::id, &Record::price,
+                        &Record::quantity, &Record::discount,
+                        &Record::created, &Record::updated, &Record::weight,
+                        &Record::volume, &Record::cost, &Record::flags));
+                  }));
+  return 0;
+}
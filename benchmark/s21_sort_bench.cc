@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "../sort/s21_sort.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+// Размер можно передать первым аргументом, например 100000000
+constexpr size_t kDefaultElements = 1 << 24;
+
+template <typename T>
+s21::Vector<T> MakeKeys(size_t size) {
+  s21::Vector<T> keys(size);
+  uint64_t state = 88172645463325252ULL;
+  for (size_t i = 0; i < size; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    if constexpr (std::is_floating_point_v<T>) {
+      keys[i] = static_cast<T>(static_cast<int64_t>(state) / 1e9);
+    } else {
+      keys[i] = static_cast<T>(state);
+    }
+  }
+  return keys;
+}
+
+// Сортирует копию keys и печатает время в нс на элемент
+template <typename T, typename SortFunction>
+double Run(const char* name, const s21::Vector<T>& keys, SortFunction sort) {
+  s21::Vector<T> work(keys);
+  auto result = s21::bench::Measure(1, [&](size_t) {
+    sort(work.Data(), work.Data() + work.Size());
+  });
+  if (!std::is_sorted(work.Begin(), work.End())) {
+    std::printf("%s: result is not sorted\n", name);
+    std::exit(1);
+  }
+  result.ns_per_op /= keys.Size();
+  s21::bench::Report(name, result);
+  return result.ns_per_op;
+}
+
+template <typename T>
+void RunAll(const char* type, size_t count) {
+  s21::Vector<T> keys = MakeKeys<T>(count);
+  std::printf("%zu %s keys, ns per element\n", count, type);
+  double baseline = Run("std::sort", keys, [](T* first, T* last) {
+    std::sort(first, last);
+  });
+  Run("s21::PdqSort", keys,
+      [](T* first, T* last) { s21::PdqSort(first, last); });
+  for (auto digit : {s21::RadixDigit::k8, s21::RadixDigit::k11,
+                     s21::RadixDigit::k16}) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "s21::RadixSort, %d-bit digits",
+                  static_cast<int>(digit));
+    Run(name, keys, [digit](T* first, T* last) {
+      s21::RadixSort(first, last, digit);
+    });
+  }
+  double dispatched =
+      Run("s21::Sort", keys, [](T* first, T* last) { s21::Sort(first, last); });
+  std::printf("s21::Sort speedup over std::sort: %.1fx\n\n",
+              baseline / dispatched);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                          : kDefaultElements;
+  RunAll<uint64_t>("uint64_t", count);
+  RunAll<uint32_t>("uint32_t", count);
+  RunAll<float>("float", count);
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+#include "../tombstone_vector/s21_tombstone_vector.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+// Удаление по одному из Vector квадратично, поэтому размер умеренный
+constexpr size_t kElements = 1 << 18;
+constexpr size_t kErased = kElements / 10;
+
+// Номера ячеек для удаления по убыванию, чтобы Vector::Erase не сдвигал
+// ещё не удалённые номера
+s21::Vector<size_t> MakeVictims() {
+  s21::Vector<bool> taken(kElements);
+  s21::Vector<size_t> victims;
+  uint64_t state = 2463534242;
+  while (victims.Size() < kErased) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    size_t slot = state % kElements;
+    if (!taken[slot]) {
+      taken[slot] = true;
+      victims.PushBack(slot);
+    }
+  }
+  return victims;
+}
+
+s21::Vector<int64_t> MakeValues() {
+  s21::Vector<int64_t> values(kElements);
+  for (size_t i = 0; i < kElements; ++i) values[i] = i;
+  return values;
+}
+
+// Время на одно удаление
+void ReportPerErase(const char *name, s21::bench::Result result) {
+  result.ns_per_op /= kErased;
+  result.allocs_per_op /= kErased;
+  s21::bench::Report(name, result);
+}
+
+}  // namespace
+
+int main() {
+  s21::Vector<size_t> victims = MakeVictims();
+  s21::Vector<size_t> descending = victims;
+  std::sort(descending.Begin(), descending.End(), std::greater<size_t>());
+  s21::Vector<bool> doomed(kElements);
+  for (size_t i = 0; i < kErased; ++i) doomed[victims[i]] = true;
+
+  ReportPerErase("Vector::Erase one by one",
+                 s21::bench::Measure(1, [&](size_t) {
+                   s21::Vector<int64_t> values = MakeValues();
+                   for (size_t i = 0; i < kErased; ++i) {
+                     values.Erase(values.Begin() + descending[i]);
+                   }
+                   s21::bench::DoNotOptimize(values.Size());
+                 }));
+  ReportPerErase("Vector::EraseIf", s21::bench::Measure(5, [&](size_t) {
+                   s21::Vector<int64_t> values = MakeValues();
+                   values.EraseIf(
+                       [&doomed](int64_t value) { return doomed[value]; });
+                   s21::bench::DoNotOptimize(values.Size());
+                 }));
+  ReportPerErase("TombstoneVector Erase + Compact",
+                 s21::bench::Measure(5, [&](size_t) {
+                   s21::TombstoneVector<int64_t> values(MakeValues());
+                   values.SetCompactThreshold(1);
+                   for (size_t i = 0; i < kErased; ++i) {
+                     values.Erase(victims[i]);
+                   }
+                   values.Compact();
+                   s21::bench::DoNotOptimize(values.Size());
+                 }));
+  ReportPerErase("TombstoneVector::EraseIf",
+                 s21::bench::Measure(5, [&](size_t) {
+                   s21::TombstoneVector<int64_t> values(MakeValues());
+                   values.SetCompactThreshold(0.05);
+                   values.EraseIf(
+                       [&doomed](int64_t value) { return doomed[value]; });
+                   s21::bench::DoNotOptimize(values.Size());
+                 }));
+
+  // Обход с 10% удалённых против уже уплотнённого
+  s21::TombstoneVector<int64_t> sparse(MakeValues());
+  sparse.SetCompactThreshold(1);
+  for (size_t i = 0; i < kErased; ++i) sparse.Erase(victims[i]);
+  s21::TombstoneVector<int64_t> compacted = sparse;
+  compacted.Compact();
+  auto report_sum = [](const char *name,
+                       const s21::TombstoneVector<int64_t> &values) {
+    s21::bench::Result result = s21::bench::Measure(20, [&](size_t) {
+      int64_t sum = 0;
+      values.ForEach([&sum](int64_t value) { sum += value; });
+      s21::bench::DoNotOptimize(sum);
+    });
+    result.ns_per_op /= values.Size();
+    s21::bench::Report(name, result);
+  };
+  report_sum("ForEach sum, 10% dead", sparse);
+  report_sum("ForEach sum, compacted", compacted);
+  return 0;
+}
@@ -0,0 +1,72 @@
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+
+#include "../memory/s21_mmap_allocator.h"
+#include "../vector/s21_vector.h"
+#include "bench.h"
+
+namespace {
+
+// Около 300 МБ данных по умолчанию, размер можно передать первым аргументом.
+// Размер не степень двойки, иначе удвоение попадает ровно в него.
+constexpr size_t kDefaultElements = 40000000;
+
+template <typename Container>
+void Grow(size_t count) {
+  Container vec;
+  for (size_t i = 0; i < count; ++i) {
+    vec.PushBack(i);
+  }
+  s21::bench::DoNotOptimize(vec[count - 1]);
+}
+
+/*
+ * Каждый вариант запускается в отдельном процессе, чтобы пиковый RSS
+ * (ru_maxrss) относился только к нему
+ */
+template <typename Container>
+void RunIsolated(const char* name, size_t count) {
+  std::fflush(stdout);
+  pid_t pid = fork();
+  if (pid == 0) {
+    auto result = s21::bench::Measure(1, [count](size_t) {
+      Grow<Container>(count);
+    });
+    std::printf("%-36s %8.1f ms", name, result.ns_per_op / 1e6);
+    std::fflush(stdout);
+    std::_Exit(0);
+  }
+  int status = 0;
+  rusage usage{};
+  wait4(pid, &status, 0, &usage);
+#if defined(__APPLE__)
+  double peak_mb = usage.ru_maxrss / 1048576.0;
+#else
+  double peak_mb = usage.ru_maxrss / 1024.0;
+#endif
+  std::printf("   peak RSS %8.1f MB (%.2fx payload)\n", peak_mb,
+              peak_mb / (count * sizeof(uint64_t) / 1048576.0));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                          : kDefaultElements;
+  std::printf("PushBack of %zu uint64_t (%.0f MB)\n", count,
+              count * sizeof(uint64_t) / 1048576.0);
+  RunIsolated<s21::Vector<uint64_t>>("Vector, HeapAllocator, x2", count);
+  RunIsolated<s21::Vector<uint64_t, s21::GrowByHalf>>(
+      "Vector, HeapAllocator, x1.5", count);
+  RunIsolated<s21::Vector<uint64_t, s21::GrowByDoubling,
+                          s21::MmapAllocator<uint64_t>>>(
+      "Vector, MmapAllocator, x2", count);
+  RunIsolated<s21::Vector<uint64_t, s21::GrowByHalf,
+                          s21::MmapAllocator<uint64_t>>>(
+      "Vector, MmapAllocator, x1.5", count);
+  return 0;
+}
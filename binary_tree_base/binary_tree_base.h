@@ -1,10 +1,20 @@
 #ifndef SRC_BINARY_TREE_BASE_BINARY_TREE_BASE_H_
 #define SRC_BINARY_TREE_BASE_BINARY_TREE_BASE_H_
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <new>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
+
 template <typename Key, typename T>
 class BinaryTreeBase {
  protected:
@@ -14,24 +24,48 @@ class BinaryTreeBase {
     Node* left;
     Node* right;
     Node* parent;
+    size_t count;  // число узлов в поддереве
+    std::uint32_t priority;  // приоритет декартова дерева
+    std::uint32_t slot;  // номер в блоке Compact() плюс 1, 0 - узел в куче
 
     // Создание нового узла
-    Node(const Key& key, const T& value)
-        : key(key),
-          value(value),
+    template <typename K, typename V>
+    Node(K&& key, V&& value)
+        : key(std::forward<K>(key)),
+          value(std::forward<V>(value)),
           left(nullptr),
           right(nullptr),
-          parent(nullptr) {}
+          parent(nullptr),
+          count(1),
+          priority(NextPriority()),
+          slot(0) {}
 
-    // Копирование из 1 узла в другой
+    // Копирование из 1 узла в другой (размер поддерева сохраняется)
     Node(const Node& other)
         : key(other.key),
           value(other.value),
           left(nullptr),
           right(nullptr),
-          parent(nullptr) {}
+          parent(nullptr),
+          count(other.count),
+          priority(other.priority),
+          slot(0) {}
+  };
+
+  /*
+   * Заголовок непрерывного блока, в который Compact() переносит узлы; узлы
+   * лежат сразу за ним. Узел блока находит заголовок по своему номеру slot,
+   * поэтому деревьям не нужен список блоков, а Split и Join просто
+   * передают узлы. Блок освобождается вместе с последним живым узлом, в
+   * каком бы дереве тот ни оказался, поэтому счётчик атомарный.
+   */
+  struct Slab {
+    std::atomic<size_t> live;
   };
 
+  // Начиная с этого размера копирование дерева распределяется по потокам
+  static constexpr size_t kParallelCopyThreshold = 1 << 16;
+
   Node* root_;
   size_t size_;
 
@@ -39,7 +73,7 @@ class BinaryTreeBase {
   BinaryTreeBase(const BinaryTreeBase& other);
   BinaryTreeBase(BinaryTreeBase&& other) noexcept;
   BinaryTreeBase(std::initializer_list<Node> init);
-  Node* CopyNodes(Node* node);
+  static Node* CopyNodes(Node* node, Node* block, Node* place);
 
   using size_type = std::size_t;
   size_type Erase(const Key& key);
@@ -52,11 +86,24 @@ class BinaryTreeBase {
 
   Node* MinNode(Node* node) const;
   Node* MaxNode(Node* node) const;
+  Node* NodeAtRank(size_t rank) const;
+
+  void AttachNode(Node* node, Node* parent);
+  void UpdateCounts(Node* node);
+  static size_t SubtreeSize(const Node* node);
+  size_t CountBelow(const Key& key, bool inclusive) const;
+
+  void SplitInto(const Key& key, BinaryTreeBase& left, BinaryTreeBase& right);
+  void JoinFrom(BinaryTreeBase& left, BinaryTreeBase& right, bool unique);
+
+  template <typename Function>
+  void ParallelForEachNode(Function fn, size_t threads);
 
  public:
   ~BinaryTreeBase();
   BinaryTreeBase& operator=(const BinaryTreeBase& other);
   BinaryTreeBase& operator=(BinaryTreeBase&& other) noexcept;
+  void Compact();
   class Iterator {
    private:
     Node* current_;
@@ -77,12 +124,35 @@ class BinaryTreeBase {
   const Iterator Begin() const;
   const Iterator End() const;
 
+  std::vector<std::pair<Iterator, Iterator>> SplitRanges(size_t parts) const;
+
  protected:
   std::pair<Iterator, bool> Insert(const Key& key, const T& value);
 
  private:
+  static std::uint32_t NextPriority();
   void Transplant(Node* u, Node* v);
+  void RotateUp(Node* node);
+  static Node* JoinNodes(Node* left, Node* right);
+  static void SplitNodes(Node* node, const Key& key, Node*& left,
+                         Node*& right);
   void ClearHelper(Node* node);
+  void CopyTree(const BinaryTreeBase& other);
+  static Node* ParallelCopyNodes(Node* root, Node* block, size_t threads);
+  static constexpr size_t kSlabHeader =
+      (sizeof(Slab) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+  static constexpr size_t kMaxSlabNodes =
+      std::numeric_limits<std::uint32_t>::max();
+
+  // Выделяет блок на count узлов и возвращает место первого из них
+  static Node* AllocateSlab(size_t count);
+  static void FreeSlab(Node* block);
+  static Node* PlaceCopy(const Node& source, Node* block, Node* place);
+  static void DestroyRange(Node* first, Node* last);
+  static void SetSlot(Node* node, Node* block);
+  static void DestroyNode(Node* node);
+  static Node* RelocateNode(Node* node, Node* parent, Node* place,
+                            Node* block);
 };
 
 #include "binary_tree_base.tpp"
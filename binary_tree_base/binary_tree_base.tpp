@@ -1,14 +1,49 @@
 #ifndef SRC_BINARY_TREE_BASE_BINARY_TREE_BASE_TPP_
 #define SRC_BINARY_TREE_BASE_BINARY_TREE_BASE_TPP_
 
+/*
+ * Копирует поддерево node в прямом порядке в блок block, начиная с места
+ * place, где должно хватать места на все узлы поддерева. Обход итеративный:
+ * вверх поднимаемся по указателям на родителя одновременно в исходном
+ * дереве и в копии, поэтому глубина дерева не ограничена размером стека.
+ * Если копирование ключа или значения бросает исключение, уже созданные
+ * узлы разрушаются, память блока остаётся вызывающему.
+ */
 template <typename Key, typename T>
 typename BinaryTreeBase<Key, T>::Node* BinaryTreeBase<Key, T>::CopyNodes(
-    Node* node) {
+    Node* node, Node* block, Node* place) {
   if (!node) return nullptr;
-  Node* newNode = new Node(*node);
-  newNode->left = CopyNodes(node->left);
-  newNode->right = CopyNodes(node->right);
-  return newNode;
+  Node* first = place;
+  try {
+    Node* copy = PlaceCopy(*node, block, place);
+    ++place;
+    Node* source = node;
+    Node* target = copy;
+    while (true) {
+      if (source->left && !target->left) {
+        target->left = PlaceCopy(*source->left, block, place);
+        ++place;
+        target->left->parent = target;
+        source = source->left;
+        target = target->left;
+      } else if (source->right && !target->right) {
+        target->right = PlaceCopy(*source->right, block, place);
+        ++place;
+        target->right->parent = target;
+        source = source->right;
+        target = target->right;
+      } else if (source != node) {
+        source = source->parent;
+        target = target->parent;
+      } else {
+        break;
+      }
+    }
+    return copy;
+  } catch (...) {
+    DestroyRange(first, place);
+    throw;
+  }
 }
 
 template <typename Key, typename T>
@@ -16,7 +51,9 @@ BinaryTreeBase<Key, T>::BinaryTreeBase() : root_(nullptr), size_(0) {}
 
 template <typename Key, typename T>
 BinaryTreeBase<Key, T>::BinaryTreeBase(const BinaryTreeBase& other)
-    : root_(CopyNodes(other.root_)), size_(other.size_) {}
+    : root_(nullptr), size_(0) {
+  CopyTree(other);
+}
 
 template <typename Key, typename T>
 BinaryTreeBase<Key, T>::BinaryTreeBase(BinaryTreeBase&& other) noexcept
@@ -43,8 +80,7 @@ BinaryTreeBase<Key, T>& BinaryTreeBase<Key, T>::operator=(
     const BinaryTreeBase<Key, T>& other) {
   if (this != &other) {
     Clear();
-    root_ = CopyNodes(other.root_);
-    size_ = other.size_;
+    CopyTree(other);
   }
   return *this;
 }
@@ -91,13 +127,7 @@ BinaryTreeBase<Key, T>::Insert(const Key& key, const T& value) {
     }
 
     if (flag) {
-      new_node->parent = parent;
-      if (key < parent->key) {
-        parent->left = new_node;
-      } else {
-        parent->right = new_node;
-      }
-      size_++;
+      AttachNode(new_node, parent);
     }
   }
 
@@ -111,30 +141,259 @@ typename BinaryTreeBase<Key, T>::size_type BinaryTreeBase<Key, T>::Erase(
   size_type counter = 0;
   while (node) {
     Node* node_to_delete = node;
-    if (!node->left) {
-      Transplant(node, node->right);
-    } else if (!node->right) {
-      Transplant(node, node->left);
-    } else {
-      Node* successor = MinNode(node->right);
-      if (successor->parent != node) {
-        Transplant(successor, successor->right);
-        successor->right = node->right;
-        successor->right->parent = successor;
-      }
-      Transplant(node, successor);
-      successor->left = node->left;
-      successor->left->parent = successor;
-    }
+    // место узла занимает слияние его поддеревьев
+    Transplant(node, JoinNodes(node->left, node->right));
+    UpdateCounts(node->parent);
 
     node = FindNode(key);
-    delete node_to_delete;
+    DestroyNode(node_to_delete);
     --size_;
     ++counter;
   }
   return counter;
 }
 
+/*
+ * Подвешивает новый узел к parent (или делает корнем), обновляет размеры и
+ * поворотами поднимает узел, пока его приоритет выше родительского.
+ */
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::AttachNode(Node* node, Node* parent) {
+  node->parent = parent;
+  if (!parent) {
+    root_ = node;
+  } else if (node->key < parent->key) {
+    parent->left = node;
+  } else {
+    parent->right = node;
+  }
+  UpdateCounts(parent);
+  ++size_;
+  while (node->parent && node->priority > node->parent->priority) {
+    RotateUp(node);
+  }
+}
+
+// Поворот, после которого node занимает место своего родителя
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::RotateUp(Node* node) {
+  Node* parent = node->parent;
+  if (node == parent->left) {
+    parent->left = node->right;
+    if (node->right) node->right->parent = parent;
+    node->right = parent;
+  } else {
+    parent->right = node->left;
+    if (node->left) node->left->parent = parent;
+    node->left = parent;
+  }
+  Transplant(parent, node);
+  parent->parent = node;
+  parent->count = 1 + SubtreeSize(parent->left) + SubtreeSize(parent->right);
+  node->count = 1 + SubtreeSize(node->left) + SubtreeSize(node->right);
+}
+
+// Случайный приоритет узла (splitmix64 от счётчика потока)
+template <typename Key, typename T>
+std::uint32_t BinaryTreeBase<Key, T>::NextPriority() {
+  static thread_local std::uint64_t state =
+      reinterpret_cast<std::uintptr_t>(&state);
+  std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return static_cast<std::uint32_t>((z ^ (z >> 31)) >> 32);
+}
+
+/*
+ * Слияние двух поддеревьев, где все ключи left не больше ключей right.
+ * Корнем становится узел с большим приоритетом, глубина рекурсии - сумма
+ * длин правой ветви left и левой ветви right, то есть O(log n).
+ */
+template <typename Key, typename T>
+typename BinaryTreeBase<Key, T>::Node* BinaryTreeBase<Key, T>::JoinNodes(
+    Node* left, Node* right) {
+  if (!left) return right;
+  if (!right) return left;
+  if (left->priority > right->priority) {
+    left->right = JoinNodes(left->right, right);
+    left->right->parent = left;
+    left->count = 1 + SubtreeSize(left->left) + SubtreeSize(left->right);
+    return left;
+  }
+  right->left = JoinNodes(left, right->left);
+  right->left->parent = right;
+  right->count = 1 + SubtreeSize(right->left) + SubtreeSize(right->right);
+  return right;
+}
+
+// Разрезает поддерево на ключи меньше key (left) и не меньше key (right)
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::SplitNodes(Node* node, const Key& key,
+                                        Node*& left, Node*& right) {
+  if (!node) {
+    left = right = nullptr;
+    return;
+  }
+  if (node->key < key) {
+    SplitNodes(node->right, key, node->right, right);
+    if (node->right) node->right->parent = node;
+    left = node;
+  } else {
+    SplitNodes(node->left, key, left, node->left);
+    if (node->left) node->left->parent = node;
+    right = node;
+  }
+  node->count = 1 + SubtreeSize(node->left) + SubtreeSize(node->right);
+}
+
+/*
+ * Переносит узлы дерева в left (ключи меньше key) и right (остальные) за
+ * O(log n) без перевыделения памяти. Прежнее содержимое left и right
+ * удаляется, дерево остаётся пустым.
+ */
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::SplitInto(const Key& key, BinaryTreeBase& left,
+                                       BinaryTreeBase& right) {
+  left.Clear();
+  right.Clear();
+  SplitNodes(root_, key, left.root_, right.root_);
+  for (BinaryTreeBase* part : {&left, &right}) {
+    if (part->root_) part->root_->parent = nullptr;
+    part->size_ = SubtreeSize(part->root_);
+  }
+  root_ = nullptr;
+  size_ = 0;
+}
+
+/*
+ * Забирает узлы left и right (все ключи left меньше ключей right, либо не
+ * больше, если unique == false) и сливает их в это дерево за O(log n).
+ * Прежнее содержимое удаляется, left и right остаются пустыми.
+ */
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::JoinFrom(BinaryTreeBase& left,
+                                      BinaryTreeBase& right, bool unique) {
+  if (left.root_ && right.root_) {
+    const Key& left_max = left.MaxNode(left.root_)->key;
+    const Key& right_min = right.MinNode(right.root_)->key;
+    if (unique ? !(left_max < right_min) : right_min < left_max) {
+      throw std::invalid_argument("Join: keys of left exceed keys of right");
+    }
+  }
+  Node* root = JoinNodes(left.root_, right.root_);
+  Clear();
+  for (BinaryTreeBase* part : {&left, &right}) {
+    part->root_ = nullptr;
+    part->size_ = 0;
+  }
+  root_ = root;
+  if (root_) root_->parent = nullptr;
+  size_ = SubtreeSize(root_);
+}
+
+// Число ключей меньше key (или не больше key при inclusive)
+template <typename Key, typename T>
+size_t BinaryTreeBase<Key, T>::CountBelow(const Key& key,
+                                          bool inclusive) const {
+  size_t count = 0;
+  Node* node = root_;
+  while (node) {
+    if (node->key < key || (inclusive && !(key < node->key))) {
+      count += SubtreeSize(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return count;
+}
+
+// Пересчитывает размеры поддеревьев от node до корня
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::UpdateCounts(Node* node) {
+  while (node) {
+    node->count = 1 + SubtreeSize(node->left) + SubtreeSize(node->right);
+    node = node->parent;
+  }
+}
+
+template <typename Key, typename T>
+size_t BinaryTreeBase<Key, T>::SubtreeSize(const Node* node) {
+  return node ? node->count : 0;
+}
+
+// Узел с заданным порядковым номером в отсортированном порядке
+template <typename Key, typename T>
+typename BinaryTreeBase<Key, T>::Node* BinaryTreeBase<Key, T>::NodeAtRank(
+    size_t rank) const {
+  Node* node = root_;
+  while (node) {
+    size_t left = SubtreeSize(node->left);
+    if (rank < left) {
+      node = node->left;
+    } else if (rank == left) {
+      break;
+    } else {
+      rank -= left + 1;
+      node = node->right;
+    }
+  }
+  return node;
+}
+
+/*
+ * Делит дерево на не более чем parts непустых полуинтервалов [first, last)
+ * с почти одинаковым числом элементов. Границы ищутся по размерам поддеревьев
+ * за O(parts * log n).
+ */
+template <typename Key, typename T>
+std::vector<std::pair<typename BinaryTreeBase<Key, T>::Iterator,
+                      typename BinaryTreeBase<Key, T>::Iterator>>
+BinaryTreeBase<Key, T>::SplitRanges(size_t parts) const {
+  std::vector<std::pair<Iterator, Iterator>> ranges;
+  if (parts == 0 || size_ == 0) return ranges;
+  if (parts > size_) parts = size_;
+  Node* first = NodeAtRank(0);
+  for (size_t i = 1; i <= parts; ++i) {
+    Node* last = i == parts ? nullptr : NodeAtRank(i * size_ / parts);
+    ranges.emplace_back(Iterator(first, this), Iterator(last, this));
+    first = last;
+  }
+  return ranges;
+}
+
+/*
+ * Вызывает fn(node) для каждого узла, обрабатывая диапазоны SplitRanges в
+ * threads потоках (один из них - вызывающий). Структуру дерева fn менять не
+ * должна; первое выброшенное исключение пробрасывается после завершения всех
+ * потоков.
+ */
+template <typename Key, typename T>
+template <typename Function>
+void BinaryTreeBase<Key, T>::ParallelForEachNode(Function fn, size_t threads) {
+  if (threads == 0) threads = 1;
+  auto ranges = SplitRanges(threads);
+  std::vector<std::exception_ptr> errors(ranges.size());
+  auto process = [&fn, &ranges, &errors](size_t i) {
+    try {
+      for (Iterator it = ranges[i].first; it != ranges[i].second; ++it) {
+        fn(it.operator->());
+      }
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    workers.emplace_back(process, i);
+  }
+  if (!ranges.empty()) process(0);
+  for (auto& worker : workers) worker.join();
+  for (auto& error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
 template <typename Key, typename T>
 bool BinaryTreeBase<Key, T>::Contains(const Key& key) const {
   return FindNode(key) != nullptr;
@@ -157,6 +416,45 @@ void BinaryTreeBase<Key, T>::Clear() {
   size_ = 0;
 }
 
+/*
+ * Переносит все узлы в один непрерывный блок в порядке обхода в ширину:
+ * верхние уровни дерева, через которые проходит каждый поиск, оказываются
+ * рядом в памяти. Сам блок используется как очередь обхода. После переноса
+ * дерево остаётся изменяемым: новые узлы выделяются как обычно, а блок
+ * освобождается, когда удалены все его узлы. Деревья больше kMaxSlabNodes
+ * не уплотняются. Итераторы и указатели на узлы становятся
+ * недействительными. Если исключение бросило копирование ключа или
+ * значения, дерево остаётся прежним.
+ */
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::Compact() {
+  if (!root_ || size_ > kMaxSlabNodes) return;
+  if constexpr (!std::is_nothrow_move_constructible_v<Key> ||
+                !std::is_nothrow_move_constructible_v<T>) {
+    // Перенос, прерванный исключением, не откатить: вместо него строится
+    // копия, она тоже лежит одним блоком, а дерево при исключении не
+    // меняется. Некопируемые типы с бросающим перемещением не уплотняются
+    if constexpr (std::is_copy_constructible_v<Key> &&
+                  std::is_copy_constructible_v<T>) {
+      BinaryTreeBase copy(*this);
+      *this = std::move(copy);
+    }
+    return;
+  }
+  Node* block = AllocateSlab(size_);
+  size_t tail = 0;
+  root_ = RelocateNode(root_, nullptr, block + tail++, block);
+  for (size_t head = 0; head < tail; ++head) {
+    Node* node = block + head;
+    if (node->left) {
+      node->left = RelocateNode(node->left, node, block + tail++, block);
+    }
+    if (node->right) {
+      node->right = RelocateNode(node->right, node, block + tail++, block);
+    }
+  }
+}
+
 template <typename Key, typename T>
 typename BinaryTreeBase<Key, T>::Node* BinaryTreeBase<Key, T>::MinNode(
     Node* node) const {
@@ -213,15 +511,214 @@ void BinaryTreeBase<Key, T>::Transplant(Node* first, Node* second) {
   }
 }
 
+/*
+ * Итеративное удаление поддерева: левый ребёнок поворотом поднимается
+ * наверх, пока у текущего узла не останется левого поддерева, после чего
+ * узел удаляется и обход продолжается с правого. Дополнительной памяти и
+ * указателей на родителя не требуется.
+ */
 template <typename Key, typename T>
 void BinaryTreeBase<Key, T>::ClearHelper(Node* node) {
-  if (node) {
-    ClearHelper(node->left);
-    ClearHelper(node->right);
+  while (node) {
+    if (node->left) {
+      Node* left = node->left;
+      node->left = left->right;
+      left->right = node;
+      node = left;
+    } else {
+      Node* right = node->right;
+      DestroyNode(node);
+      node = right;
+    }
+  }
+}
+
+// Копия дерева размещается одним блоком, как после Compact()
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::CopyTree(const BinaryTreeBase& other) {
+  if (!other.root_) return;
+  Node* block = AllocateSlab(other.size_);
+  size_t threads = std::thread::hardware_concurrency();
+  try {
+    if (other.size_ >= kParallelCopyThreshold && threads > 1) {
+      root_ = ParallelCopyNodes(other.root_, block, threads);
+    } else {
+      root_ = CopyNodes(other.root_, block, block);
+    }
+  } catch (...) {
+    // Созданные узлы уже разрушены, остаётся вернуть память
+    FreeSlab(block);
+    throw;
+  }
+  size_ = other.size_;
+}
+
+/*
+ * Верхние уровни дерева копируются последовательно, а поддеревья под ними
+ * (фронт) - каждое в своём потоке. По размерам поддеревьев каждому из них
+ * выделяется непересекающийся участок блока: верхние узлы занимают начало
+ * блока, поддеревья фронта идут следом. Исключения потоков собираются и
+ * пробрасываются после завершения всех потоков, а созданные к тому времени
+ * узлы разрушаются.
+ */
+template <typename Key, typename T>
+typename BinaryTreeBase<Key, T>::Node*
+BinaryTreeBase<Key, T>::ParallelCopyNodes(Node* root, Node* block,
+                                          size_t threads) {
+  const size_t kMaxLevels = 16;
+  std::vector<Node*> top;
+  std::vector<Node*> frontier{root};
+  for (size_t level = 0; level < kMaxLevels && frontier.size() < threads;
+       ++level) {
+    std::vector<Node*> next;
+    for (Node* node : frontier) {
+      if (node->left) next.push_back(node->left);
+      if (node->right) next.push_back(node->right);
+    }
+    if (next.empty()) break;
+    top.insert(top.end(), frontier.begin(), frontier.end());
+    frontier.swap(next);
+  }
+
+  std::vector<size_t> offsets(frontier.size() + 1, top.size());
+  for (size_t i = 0; i < frontier.size(); ++i) {
+    offsets[i + 1] = offsets[i] + frontier[i]->count;
+  }
+
+  std::vector<Node*> copies(top.size() + frontier.size());
+  // Последний элемент - ошибка копирования верхних узлов
+  std::vector<std::exception_ptr> errors(frontier.size() + 1);
+  auto copy = [&copies, &offsets, &frontier, &top, &errors, block](size_t i) {
+    try {
+      copies[top.size() + i] =
+          CopyNodes(frontier[i], block, block + offsets[i]);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+  size_t top_built = 0;
+  {
+    std::vector<std::thread> workers;
+    workers.reserve(frontier.size());
+    for (size_t i = 0; i < frontier.size(); ++i) {
+      try {
+        workers.emplace_back(copy, i);
+      } catch (...) {
+        // Поток не создался - поддерево копируется здесь же
+        copy(i);
+      }
+    }
+    try {
+      for (; top_built < top.size(); ++top_built) {
+        copies[top_built] =
+            PlaceCopy(*top[top_built], block, block + top_built);
+      }
+    } catch (...) {
+      errors.back() = std::current_exception();
+    }
+    for (auto& worker : workers) worker.join();
+  }
+  for (const auto& error : errors) {
+    if (!error) continue;
+    DestroyRange(block, block + top_built);
+    for (size_t i = 0; i < frontier.size(); ++i) {
+      if (!errors[i]) DestroyRange(block + offsets[i], block + offsets[i + 1]);
+    }
+    std::rethrow_exception(error);
+  }
+
+  // top и frontier вместе идут в порядке обхода в ширину, поэтому дети
+  // очередного верхнего узла - следующие ещё не привязанные элементы
+  size_t child = 1;
+  for (size_t i = 0; i < top.size(); ++i) {
+    if (top[i]->left) {
+      copies[i]->left = copies[child++];
+      copies[i]->left->parent = copies[i];
+    }
+    if (top[i]->right) {
+      copies[i]->right = copies[child++];
+      copies[i]->right->parent = copies[i];
+    }
+  }
+  return copies[0];
+}
+
+template <typename Key, typename T>
+typename BinaryTreeBase<Key, T>::Node* BinaryTreeBase<Key, T>::AllocateSlab(
+    size_t count) {
+  if (count > kMaxSlabNodes) {
+    throw std::length_error("Too many nodes for one block");
+  }
+  char* memory =
+      static_cast<char*>(::operator new(kSlabHeader + count * sizeof(Node)));
+  new (memory) Slab{{count}};
+  return reinterpret_cast<Node*>(memory + kSlabHeader);
+}
+
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::FreeSlab(Node* block) {
+  char* memory = reinterpret_cast<char*>(block) - kSlabHeader;
+  reinterpret_cast<Slab*>(memory)->~Slab();
+  ::operator delete(memory);
+}
+
+// Копия узла source на месте place блока block
+template <typename Key, typename T>
+typename BinaryTreeBase<Key, T>::Node* BinaryTreeBase<Key, T>::PlaceCopy(
+    const Node& source, Node* block, Node* place) {
+  Node* copy = new (place) Node(source);
+  copy->slot = static_cast<std::uint32_t>(place - block + 1);
+  return copy;
+}
+
+// Разрушает узлы блока без освобождения памяти
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::DestroyRange(Node* first, Node* last) {
+  for (; first != last; ++first) first->~Node();
+}
+
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::SetSlot(Node* node, Node* block) {
+  node->slot = static_cast<std::uint32_t>(node - block + 1);
+}
+
+/*
+ * Узел из блока Compact() только разрушается; последний живой узел блока
+ * освобождает блок. Остальные узлы удаляются.
+ */
+template <typename Key, typename T>
+void BinaryTreeBase<Key, T>::DestroyNode(Node* node) {
+  if (node->slot == 0) {
     delete node;
+    return;
+  }
+  Node* block = node - (node->slot - 1);
+  Slab* slab = reinterpret_cast<Slab*>(reinterpret_cast<char*>(block) -
+                                       kSlabHeader);
+  node->~Node();
+  if (slab->live.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    FreeSlab(block);
   }
 }
 
+/*
+ * Переносит ключ и значение узла в place. Ссылки на детей пока указывают на
+ * старые узлы, их переносит следующий шаг обхода в Compact().
+ */
+template <typename Key, typename T>
+typename BinaryTreeBase<Key, T>::Node* BinaryTreeBase<Key, T>::RelocateNode(
+    Node* node, Node* parent, Node* place, Node* block) {
+  Node* moved = new (place) Node(std::move(node->key), std::move(node->value));
+  SetSlot(moved, block);
+  moved->left = node->left;
+  moved->right = node->right;
+  moved->parent = parent;
+  moved->count = node->count;
+  moved->priority = node->priority;
+  DestroyNode(node);
+  return moved;
+}
+
 // Работа с итераторами
 template <typename Key, typename T>
 BinaryTreeBase<Key, T>::Iterator::Iterator(Node* ptr,
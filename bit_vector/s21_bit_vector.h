@@ -0,0 +1,151 @@
+#ifndef SRC_BIT_VECTOR_S21_BIT_VECTOR_H_
+#define SRC_BIT_VECTOR_S21_BIT_VECTOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+
+#include "../simd/s21_simd.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * Вектор битов, упакованных в 64-битные слова: один бит на флаг вместо
+ * байта у Vector<bool>. Count() считает единицы инструкцией popcnt, если
+ * процессор её поддерживает, FindFirst/FindNext пропускают нулевые слова
+ * целиком, &=, |= и ^= работают по словам. Биты последнего слова за
+ * пределами Size() всегда нулевые.
+ *
+ * Rank(pos) — число единиц до позиции pos, Select(k) — позиция k-й единицы
+ * (с нуля). Без индекса они просматривают слова подряд. BuildRankIndex()
+ * строит индекс: на каждые 512 бит хранится число единиц до блока и
+ * упакованные по 9 бит счётчики внутри блока (ещё 25% памяти), плюс
+ * позиция каждой 512-й единицы для Select. С индексом Rank выполняется за
+ * O(1), а Select — двоичным поиском между соседними отметками. Любое
+ * изменение битов сбрасывает индекс, и его нужно построить заново.
+ */
+class BitVector {
+ public:
+  class BitReference;
+
+  using valueType = bool;
+  using reference = BitReference;
+  using constReference = bool;
+  using sizeType = size_t;
+  using wordType = uint64_t;
+
+  static constexpr sizeType kWordBits = 64;
+  // Возвращается FindFirst/FindNext/Select, если бита нет
+  static constexpr sizeType kNpos = std::numeric_limits<sizeType>::max();
+
+  // Ссылка на один бит, которую возвращает неконстантный operator[]
+  class BitReference {
+   public:
+    BitReference(BitVector *owner, sizeType pos) : owner_(owner), pos_(pos) {}
+    BitReference(const BitReference &) = default;
+
+    operator bool() const { return owner_->Test(pos_); }
+    BitReference &operator=(bool value) {
+      owner_->Set(pos_, value);
+      return *this;
+    }
+    BitReference &operator=(const BitReference &other) {
+      return *this = static_cast<bool>(other);
+    }
+    void Flip() { owner_->Flip(pos_); }
+
+   private:
+    BitVector *owner_;
+    sizeType pos_;
+  };
+
+  BitVector() = default;
+  explicit BitVector(sizeType n, bool value = false);
+  BitVector(std::initializer_list<bool> const &items);
+
+  void Swap(BitVector &other);
+
+  bool At(sizeType pos) const;
+  reference operator[](sizeType pos);
+  bool operator[](sizeType pos) const;
+  bool Test(sizeType pos) const;
+
+  void Set(sizeType pos, bool value = true);
+  void Reset(sizeType pos);
+  void Flip(sizeType pos);
+  void SetAll();
+  void ResetAll();
+  void FlipAll();
+
+  // Слова с битами, бит pos лежит в слове pos / 64 на позиции pos % 64
+  const wordType *Data() const;
+  sizeType WordCount() const;
+
+  bool Empty() const;
+  sizeType Size() const;
+  sizeType MaxSize() const;
+
+  void Reserve(sizeType size);
+  sizeType Capacity() const;
+  void ShrinkToFit();
+  void Clear();
+  // Новые биты получают значение value
+  void Resize(sizeType size, bool value = false);
+
+  void PushBack(bool value);
+  void PopBack();
+
+  sizeType Count() const;
+  bool Any() const;
+  bool None() const;
+  // Позиция первой единицы и первой единицы после pos
+  sizeType FindFirst() const;
+  sizeType FindNext(sizeType pos) const;
+
+  void BuildRankIndex();
+  bool HasRankIndex() const;
+  sizeType Rank(sizeType pos) const;
+  sizeType Select(sizeType k) const;
+
+  // Операнды должны быть одного размера, иначе std::invalid_argument
+  BitVector &operator&=(const BitVector &other);
+  BitVector &operator|=(const BitVector &other);
+  BitVector &operator^=(const BitVector &other);
+  BitVector operator~() const;
+
+  bool operator==(const BitVector &other) const;
+  bool operator!=(const BitVector &other) const;
+
+ private:
+  static constexpr sizeType kBlockWords = 8;
+  static constexpr sizeType kSelectSample = 512;
+
+  static sizeType WordsFor(sizeType bits);
+  void CheckSameSize(const BitVector &other) const;
+  void ClearTail();
+  sizeType FindFrom(sizeType start) const;
+  sizeType RankInBlock(sizeType block, sizeType word) const;
+  sizeType SelectScan(sizeType k) const;
+
+  Vector<wordType> words_;
+  sizeType size_ = 0;
+  // Пары (единиц до блока, упакованные счётчики внутри блока)
+  Vector<uint64_t> rank_index_;
+  // Блок, в котором лежит каждая kSelectSample-я единица
+  Vector<uint64_t> select_hints_;
+  sizeType ones_ = 0;
+  bool indexed_ = false;
+};
+
+inline BitVector operator&(BitVector lhs, const BitVector &rhs);
+inline BitVector operator|(BitVector lhs, const BitVector &rhs);
+inline BitVector operator^(BitVector lhs, const BitVector &rhs);
+
+}  // namespace s21
+
+#include "s21_bit_vector.tpp"
+
+#endif  // SRC_BIT_VECTOR_S21_BIT_VECTOR_H_
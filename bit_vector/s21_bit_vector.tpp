@@ -0,0 +1,426 @@
+#ifndef SRC_BIT_VECTOR_S21_BIT_VECTOR_TPP_
+#define SRC_BIT_VECTOR_S21_BIT_VECTOR_TPP_
+
+namespace s21 {
+
+namespace bit_detail {
+
+constexpr uint64_t kAllOnes = ~uint64_t{0};
+
+// Единицы в каждом байте слова: сначала в парах бит, потом в четвёрках
+inline uint64_t ByteCounts(uint64_t word) {
+  word -= (word >> 1) & 0x5555555555555555ULL;
+  word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+  return (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+}
+
+// Без -mpopcnt __builtin_popcountll превращается в вызов libgcc
+inline unsigned PopCount(uint64_t word) {
+  return static_cast<unsigned>((ByteCounts(word) * 0x0101010101010101ULL) >>
+                               56);
+}
+
+inline size_t PopCountScalar(const uint64_t *words, size_t count) {
+  size_t total = 0;
+  for (size_t i = 0; i < count; ++i) {
+    total += PopCount(words[i]);
+  }
+  return total;
+}
+
+#if S21_SIMD_X86
+
+__attribute__((target("popcnt"))) inline size_t PopCountHardware(
+    const uint64_t *words, size_t count) {
+  size_t total = 0;
+  for (size_t i = 0; i < count; ++i) {
+    total += static_cast<size_t>(__builtin_popcountll(words[i]));
+  }
+  return total;
+}
+
+inline bool HasPopcnt() {
+  static const bool has_popcnt = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("popcnt") != 0;
+  }();
+  return has_popcnt;
+}
+
+#endif  // S21_SIMD_X86
+
+inline size_t PopCount(const uint64_t *words, size_t count) {
+#if S21_SIMD_X86
+  if (HasPopcnt()) return PopCountHardware(words, count);
+#endif
+  return PopCountScalar(words, count);
+}
+
+/*
+ * Позиция единицы номер rank (с нуля) в слове, rank < PopCount(word).
+ * Произведение на 0x0101... даёт в байте i число единиц в байтах 0..i,
+ * по нему находим байт, а в байте снимаем младшие единицы.
+ */
+inline unsigned SelectInWord(uint64_t word, unsigned rank) {
+  uint64_t prefix = ByteCounts(word) * 0x0101010101010101ULL;
+  unsigned byte = 0;
+  while (((prefix >> (8 * byte)) & 0xFF) <= rank) {
+    ++byte;
+  }
+  if (byte > 0) rank -= (prefix >> (8 * (byte - 1))) & 0xFF;
+  uint64_t bits = (word >> (8 * byte)) & 0xFF;
+  for (; rank > 0; --rank) {
+    bits &= bits - 1;
+  }
+  return 8 * byte + static_cast<unsigned>(__builtin_ctzll(bits));
+}
+
+}  // namespace bit_detail
+
+inline BitVector::BitVector(sizeType n, bool value)
+    : words_(WordsFor(n)), size_(n) {
+  if (value) SetAll();
+}
+
+inline BitVector::BitVector(std::initializer_list<bool> const &items) {
+  Reserve(items.size());
+  for (bool value : items) {
+    PushBack(value);
+  }
+}
+
+inline void BitVector::Swap(BitVector &other) {
+  words_.Swap(other.words_);
+  std::swap(size_, other.size_);
+  rank_index_.Swap(other.rank_index_);
+  select_hints_.Swap(other.select_hints_);
+  std::swap(ones_, other.ones_);
+  std::swap(indexed_, other.indexed_);
+}
+
+inline bool BitVector::At(sizeType pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return Test(pos);
+}
+
+inline BitVector::reference BitVector::operator[](sizeType pos) {
+  return reference(this, pos);
+}
+
+inline bool BitVector::operator[](sizeType pos) const { return Test(pos); }
+
+inline bool BitVector::Test(sizeType pos) const {
+  return (words_.Data()[pos / kWordBits] >> (pos % kWordBits)) & 1;
+}
+
+inline void BitVector::Set(sizeType pos, bool value) {
+  wordType mask = wordType{1} << (pos % kWordBits);
+  if (value) {
+    words_[pos / kWordBits] |= mask;
+  } else {
+    words_[pos / kWordBits] &= ~mask;
+  }
+  indexed_ = false;
+}
+
+inline void BitVector::Reset(sizeType pos) { Set(pos, false); }
+
+inline void BitVector::Flip(sizeType pos) {
+  words_[pos / kWordBits] ^= wordType{1} << (pos % kWordBits);
+  indexed_ = false;
+}
+
+inline void BitVector::SetAll() {
+  words_.Fill(bit_detail::kAllOnes);
+  ClearTail();
+  indexed_ = false;
+}
+
+inline void BitVector::ResetAll() {
+  words_.Fill(0);
+  indexed_ = false;
+}
+
+inline void BitVector::FlipAll() {
+  for (sizeType i = 0; i < words_.Size(); ++i) {
+    words_[i] = ~words_[i];
+  }
+  ClearTail();
+  indexed_ = false;
+}
+
+inline const BitVector::wordType *BitVector::Data() const {
+  return words_.Data();
+}
+
+inline BitVector::sizeType BitVector::WordCount() const {
+  return words_.Size();
+}
+
+inline bool BitVector::Empty() const { return size_ == 0; }
+
+inline BitVector::sizeType BitVector::Size() const { return size_; }
+
+inline BitVector::sizeType BitVector::MaxSize() const {
+  return std::min(words_.MaxSize(), kNpos / kWordBits) * kWordBits;
+}
+
+inline void BitVector::Reserve(sizeType size) {
+  words_.Reserve(WordsFor(size));
+}
+
+inline BitVector::sizeType BitVector::Capacity() const {
+  return words_.Capacity() * kWordBits;
+}
+
+inline void BitVector::ShrinkToFit() { words_.ShrinkToFit(); }
+
+inline void BitVector::Clear() {
+  words_.Clear();
+  size_ = 0;
+  indexed_ = false;
+}
+
+inline void BitVector::Resize(sizeType size, bool value) {
+  sizeType old_size = size_;
+  if (size > old_size && value && old_size % kWordBits != 0) {
+    words_[old_size / kWordBits] |= bit_detail::kAllOnes
+                                    << (old_size % kWordBits);
+  }
+  sizeType words = WordsFor(size);
+  words_.Reserve(words);
+  while (words_.Size() < words) {
+    words_.PushBack(value ? bit_detail::kAllOnes : 0);
+  }
+  while (words_.Size() > words) {
+    words_.PopBack();
+  }
+  size_ = size;
+  ClearTail();
+  indexed_ = false;
+}
+
+inline void BitVector::PushBack(bool value) {
+  if (size_ % kWordBits == 0) words_.PushBack(0);
+  ++size_;
+  Set(size_ - 1, value);
+}
+
+inline void BitVector::PopBack() {
+  if (Empty()) throw std::out_of_range("BitVector is empty");
+  Reset(size_ - 1);
+  --size_;
+  if (size_ % kWordBits == 0) words_.PopBack();
+}
+
+inline BitVector::sizeType BitVector::Count() const {
+  return bit_detail::PopCount(words_.Data(), words_.Size());
+}
+
+inline bool BitVector::Any() const { return FindFrom(0) != kNpos; }
+
+inline bool BitVector::None() const { return !Any(); }
+
+inline BitVector::sizeType BitVector::FindFirst() const { return FindFrom(0); }
+
+inline BitVector::sizeType BitVector::FindNext(sizeType pos) const {
+  if (pos >= size_) return kNpos;
+  return FindFrom(pos + 1);
+}
+
+inline void BitVector::BuildRankIndex() {
+  const wordType *data = words_.Data();
+  sizeType words = words_.Size();
+  // Лишний блок в конце, чтобы Rank(Size()) не выходил за индекс
+  sizeType blocks = words / kBlockWords + 1;
+  rank_index_.Clear();
+  rank_index_.Reserve(2 * blocks);
+  select_hints_.Clear();
+  uint64_t total = 0;
+  for (sizeType block = 0; block < blocks; ++block) {
+    uint64_t packed = 0;
+    uint64_t inside = 0;
+    for (sizeType j = 0; j < kBlockWords; ++j) {
+      if (j > 0) packed |= inside << (9 * (j - 1));
+      sizeType word = block * kBlockWords + j;
+      if (word < words) inside += bit_detail::PopCount(data[word]);
+    }
+    rank_index_.PushBack(total);
+    rank_index_.PushBack(packed);
+    while (select_hints_.Size() * kSelectSample < total + inside) {
+      select_hints_.PushBack(block);
+    }
+    total += inside;
+  }
+  ones_ = total;
+  indexed_ = true;
+}
+
+inline bool BitVector::HasRankIndex() const { return indexed_; }
+
+inline BitVector::sizeType BitVector::Rank(sizeType pos) const {
+  if (pos > size_) throw std::out_of_range("Index out of range");
+  const wordType *data = words_.Data();
+  sizeType word = pos / kWordBits;
+  sizeType rank = 0;
+  if (indexed_) {
+    sizeType block = word / kBlockWords;
+    rank = rank_index_.Data()[2 * block] +
+           RankInBlock(block, word % kBlockWords);
+  } else {
+    rank = bit_detail::PopCount(data, word);
+  }
+  if (pos % kWordBits != 0) {
+    wordType mask = (wordType{1} << (pos % kWordBits)) - 1;
+    rank += bit_detail::PopCount(data[word] & mask);
+  }
+  return rank;
+}
+
+/*
+ * Отметка k / kSelectSample и следующая за ней ограничивают блоки, где
+ * лежит k-я единица. Среди них двоичным поиском ищем последний блок, до
+ * которого не больше k единиц, затем слово по счётчикам внутри блока.
+ */
+inline BitVector::sizeType BitVector::Select(sizeType k) const {
+  if (!indexed_) return SelectScan(k);
+  if (k >= ones_) return kNpos;
+  const uint64_t *index = rank_index_.Data();
+  sizeType hint = k / kSelectSample;
+  sizeType low = select_hints_.Data()[hint];
+  sizeType high = hint + 1 < select_hints_.Size()
+                      ? select_hints_.Data()[hint + 1]
+                      : rank_index_.Size() / 2 - 1;
+  while (low < high) {
+    sizeType middle = low + (high - low + 1) / 2;
+    if (index[2 * middle] <= k) {
+      low = middle;
+    } else {
+      high = middle - 1;
+    }
+  }
+  sizeType rest = k - index[2 * low];
+  sizeType j = kBlockWords - 1;
+  while (RankInBlock(low, j) > rest) {
+    --j;
+  }
+  sizeType word = low * kBlockWords + j;
+  return word * kWordBits +
+         bit_detail::SelectInWord(
+             words_.Data()[word],
+             static_cast<unsigned>(rest - RankInBlock(low, j)));
+}
+
+inline BitVector &BitVector::operator&=(const BitVector &other) {
+  CheckSameSize(other);
+  const wordType *source = other.words_.Data();
+  for (sizeType i = 0; i < words_.Size(); ++i) {
+    words_[i] &= source[i];
+  }
+  indexed_ = false;
+  return *this;
+}
+
+inline BitVector &BitVector::operator|=(const BitVector &other) {
+  CheckSameSize(other);
+  const wordType *source = other.words_.Data();
+  for (sizeType i = 0; i < words_.Size(); ++i) {
+    words_[i] |= source[i];
+  }
+  indexed_ = false;
+  return *this;
+}
+
+inline BitVector &BitVector::operator^=(const BitVector &other) {
+  CheckSameSize(other);
+  const wordType *source = other.words_.Data();
+  for (sizeType i = 0; i < words_.Size(); ++i) {
+    words_[i] ^= source[i];
+  }
+  indexed_ = false;
+  return *this;
+}
+
+inline BitVector BitVector::operator~() const {
+  BitVector result = *this;
+  result.FlipAll();
+  return result;
+}
+
+inline bool BitVector::operator==(const BitVector &other) const {
+  return size_ == other.size_ &&
+         std::equal(words_.Begin(), words_.End(), other.words_.Begin());
+}
+
+inline bool BitVector::operator!=(const BitVector &other) const {
+  return !(*this == other);
+}
+
+inline BitVector::sizeType BitVector::WordsFor(sizeType bits) {
+  return bits / kWordBits + (bits % kWordBits != 0);
+}
+
+inline void BitVector::CheckSameSize(const BitVector &other) const {
+  if (size_ != other.size_) {
+    throw std::invalid_argument("BitVector sizes differ");
+  }
+}
+
+// Обнуляет биты последнего слова за пределами size_
+inline void BitVector::ClearTail() {
+  if (size_ % kWordBits != 0) {
+    words_[size_ / kWordBits] &=
+        (wordType{1} << (size_ % kWordBits)) - 1;
+  }
+}
+
+inline BitVector::sizeType BitVector::FindFrom(sizeType start) const {
+  if (start >= size_) return kNpos;
+  const wordType *data = words_.Data();
+  sizeType word = start / kWordBits;
+  wordType bits = data[word] & (bit_detail::kAllOnes << (start % kWordBits));
+  while (bits == 0) {
+    if (++word == words_.Size()) return kNpos;
+    bits = data[word];
+  }
+  return word * kWordBits + static_cast<sizeType>(__builtin_ctzll(bits));
+}
+
+// Единиц в блоке block до его слова word
+inline BitVector::sizeType BitVector::RankInBlock(sizeType block,
+                                                  sizeType word) const {
+  if (word == 0) return 0;
+  return (rank_index_.Data()[2 * block + 1] >> (9 * (word - 1))) & 0x1FF;
+}
+
+inline BitVector::sizeType BitVector::SelectScan(sizeType k) const {
+  const wordType *data = words_.Data();
+  for (sizeType word = 0; word < words_.Size(); ++word) {
+    sizeType ones = bit_detail::PopCount(data[word]);
+    if (k < ones) {
+      return word * kWordBits +
+             bit_detail::SelectInWord(data[word], static_cast<unsigned>(k));
+    }
+    k -= ones;
+  }
+  return kNpos;
+}
+
+inline BitVector operator&(BitVector lhs, const BitVector &rhs) {
+  lhs &= rhs;
+  return lhs;
+}
+
+inline BitVector operator|(BitVector lhs, const BitVector &rhs) {
+  lhs |= rhs;
+  return lhs;
+}
+
+inline BitVector operator^(BitVector lhs, const BitVector &rhs) {
+  lhs ^= rhs;
+  return lhs;
+}
+
+}  // namespace s21
+
+#endif  // SRC_BIT_VECTOR_S21_BIT_VECTOR_TPP_
@@ -0,0 +1,130 @@
+#ifndef SRC_COMPACT_SET_S21_COMPACT_SET_H_
+#define SRC_COMPACT_SET_S21_COMPACT_SET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * Множество с компактными узлами: вместо трёх указателей узел хранит два
+ * 32-битных индекса в общем массиве узлов, а цвет (левостороннее
+ * красно-чёрное дерево) упакован в старший бит левой ссылки. Указателя на
+ * родителя нет, поэтому итератор хранит путь от корня на стеке.
+ * Для Key = uint32_t узел занимает 12 байт (8 байт служебных данных).
+ */
+template <typename Key>
+class CompactSet {
+ public:
+  using key_type = Key;
+  using size_type = std::size_t;
+  using index_type = std::uint32_t;
+
+ private:
+  static constexpr index_type kNil = 0x7FFFFFFF;
+  static constexpr index_type kIndexMask = 0x7FFFFFFF;
+  static constexpr index_type kRedBit = 0x80000000;
+  // Высота LLRB-дерева не превышает 2 * log2(n + 1), n < 2^31
+  static constexpr size_type kMaxHeight = 64;
+
+  struct Node {
+    Key key;
+    index_type left;  // старший бит - цвет узла
+    index_type right;
+  };
+
+  // Путь от вставленного (или найденного) узла вверх до корня поддерева
+  struct InsertPath {
+    index_type nodes[kMaxHeight];
+    size_type size;
+  };
+
+ public:
+  class Iterator {
+    friend class CompactSet;
+
+   public:
+    const Key& operator*() const;
+    const Key* operator->() const;
+    Iterator& operator++();
+    Iterator& operator--();
+    bool operator==(const Iterator& other) const;
+    bool operator!=(const Iterator& other) const;
+
+   private:
+    explicit Iterator(const CompactSet* set) : set_(set), depth_(0) {}
+
+    void PushLeftmost(index_type node);
+    void PushRightmost(index_type node);
+
+    const CompactSet* set_;
+    index_type path_[kMaxHeight];
+    size_type depth_;
+  };
+
+  CompactSet();
+  CompactSet(std::initializer_list<Key> init);
+  CompactSet(const CompactSet& other) = default;
+  CompactSet(CompactSet&& other) noexcept;
+  ~CompactSet() = default;
+
+  CompactSet& operator=(const CompactSet& other) = default;
+  CompactSet& operator=(CompactSet&& other) noexcept;
+
+  std::pair<Iterator, bool> Insert(const Key& key);
+  size_type Erase(const Key& key);
+  bool Contains(const Key& key) const;
+  Iterator Find(const Key& key) const;
+
+  Iterator Begin() const;
+  Iterator End() const;
+
+  bool Empty() const;
+  size_type Size() const;
+  size_type MaxSize() const;
+  void Clear();
+
+  void Reserve(size_type count);
+  size_type Capacity() const;
+
+ private:
+  index_type Left(index_type node) const;
+  index_type Right(index_type node) const;
+  bool IsRed(index_type node) const;
+  void SetLeft(index_type node, index_type left);
+  void SetRight(index_type node, index_type right);
+  void SetRed(index_type node, bool red);
+
+  index_type NewNode(const Key& key);
+  void FreeNode(index_type node);
+
+  index_type RotateLeft(index_type node);
+  index_type RotateRight(index_type node);
+  void FlipColors(index_type node);
+  index_type MoveRedLeft(index_type node);
+  index_type MoveRedRight(index_type node);
+  index_type Balance(index_type node);
+
+  index_type InsertHelper(index_type node, const Key& key, bool& inserted,
+                          InsertPath& path);
+  // Поправляет путь после поворота в его верхнем узле; top - новый корень
+  index_type TrackRotation(index_type top, InsertPath& path) const;
+  index_type EraseHelper(index_type node, const Key& key);
+  index_type EraseMin(index_type node);
+
+  Vector<Node> nodes_;
+  index_type root_;
+  index_type free_;  // список освобождённых узлов, связанный через left
+  size_type size_;
+};
+
+}  // namespace s21
+
+#include "s21_compact_set.tpp"
+
+#endif  // SRC_COMPACT_SET_S21_COMPACT_SET_H_
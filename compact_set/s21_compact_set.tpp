@@ -0,0 +1,449 @@
+#ifndef SRC_COMPACT_SET_S21_COMPACT_SET_TPP_
+#define SRC_COMPACT_SET_S21_COMPACT_SET_TPP_
+
+namespace s21 {
+
+template <typename Key>
+CompactSet<Key>::CompactSet() : root_(kNil), free_(kNil), size_(0) {}
+
+template <typename Key>
+CompactSet<Key>::CompactSet(std::initializer_list<Key> init) : CompactSet() {
+  for (const auto& key : init) {
+    Insert(key);
+  }
+}
+
+template <typename Key>
+CompactSet<Key>::CompactSet(CompactSet&& other) noexcept
+    : nodes_(std::move(other.nodes_)),
+      root_(other.root_),
+      free_(other.free_),
+      size_(other.size_) {
+  other.root_ = kNil;
+  other.free_ = kNil;
+  other.size_ = 0;
+}
+
+template <typename Key>
+CompactSet<Key>& CompactSet<Key>::operator=(CompactSet&& other) noexcept {
+  if (this != &other) {
+    nodes_ = std::move(other.nodes_);
+    root_ = other.root_;
+    free_ = other.free_;
+    size_ = other.size_;
+    other.root_ = kNil;
+    other.free_ = kNil;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+template <typename Key>
+std::pair<typename CompactSet<Key>::Iterator, bool> CompactSet<Key>::Insert(
+    const Key& key) {
+  bool inserted = false;
+  InsertPath path;
+  path.size = 0;
+  root_ = InsertHelper(root_, key, inserted, path);
+  SetRed(root_, false);
+  Iterator it(this);
+  while (path.size > 0) it.path_[it.depth_++] = path.nodes[--path.size];
+  return {it, inserted};
+}
+
+template <typename Key>
+typename CompactSet<Key>::size_type CompactSet<Key>::Erase(const Key& key) {
+  if (!Contains(key)) return 0;
+  if (!IsRed(Left(root_)) && !IsRed(Right(root_))) {
+    SetRed(root_, true);
+  }
+  root_ = EraseHelper(root_, key);
+  if (root_ != kNil) SetRed(root_, false);
+  return 1;
+}
+
+template <typename Key>
+bool CompactSet<Key>::Contains(const Key& key) const {
+  const Node* nodes = nodes_.Data();
+  index_type current = root_;
+  while (current != kNil) {
+    if (key < nodes[current].key) {
+      current = Left(current);
+    } else if (nodes[current].key < key) {
+      current = Right(current);
+    } else {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename Key>
+typename CompactSet<Key>::Iterator CompactSet<Key>::Find(const Key& key) const {
+  const Node* nodes = nodes_.Data();
+  Iterator it(this);
+  index_type current = root_;
+  while (current != kNil) {
+    it.path_[it.depth_++] = current;
+    if (key < nodes[current].key) {
+      current = Left(current);
+    } else if (nodes[current].key < key) {
+      current = Right(current);
+    } else {
+      return it;
+    }
+  }
+  return End();
+}
+
+template <typename Key>
+typename CompactSet<Key>::Iterator CompactSet<Key>::Begin() const {
+  Iterator it(this);
+  it.PushLeftmost(root_);
+  return it;
+}
+
+template <typename Key>
+typename CompactSet<Key>::Iterator CompactSet<Key>::End() const {
+  return Iterator(this);
+}
+
+template <typename Key>
+bool CompactSet<Key>::Empty() const {
+  return size_ == 0;
+}
+
+template <typename Key>
+typename CompactSet<Key>::size_type CompactSet<Key>::Size() const {
+  return size_;
+}
+
+template <typename Key>
+typename CompactSet<Key>::size_type CompactSet<Key>::MaxSize() const {
+  return kNil;
+}
+
+template <typename Key>
+void CompactSet<Key>::Clear() {
+  nodes_.Clear();
+  root_ = kNil;
+  free_ = kNil;
+  size_ = 0;
+}
+
+template <typename Key>
+void CompactSet<Key>::Reserve(size_type count) {
+  if (count > MaxSize()) {
+    throw std::length_error("Requested Size exceeds the maximum Size.");
+  }
+  nodes_.Reserve(count);
+}
+
+template <typename Key>
+typename CompactSet<Key>::size_type CompactSet<Key>::Capacity() const {
+  return nodes_.Capacity();
+}
+
+// Доступ к ссылкам и цвету узла
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::Left(
+    index_type node) const {
+  return nodes_.Data()[node].left & kIndexMask;
+}
+
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::Right(
+    index_type node) const {
+  return nodes_.Data()[node].right;
+}
+
+template <typename Key>
+bool CompactSet<Key>::IsRed(index_type node) const {
+  return node != kNil && (nodes_.Data()[node].left & kRedBit) != 0;
+}
+
+template <typename Key>
+void CompactSet<Key>::SetLeft(index_type node, index_type left) {
+  nodes_[node].left = (nodes_[node].left & kRedBit) | left;
+}
+
+template <typename Key>
+void CompactSet<Key>::SetRight(index_type node, index_type right) {
+  nodes_[node].right = right;
+}
+
+template <typename Key>
+void CompactSet<Key>::SetRed(index_type node, bool red) {
+  if (red) {
+    nodes_[node].left |= kRedBit;
+  } else {
+    nodes_[node].left &= kIndexMask;
+  }
+}
+
+// Новый узел берётся из списка свободных, иначе добавляется в конец массива
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::NewNode(const Key& key) {
+  index_type node = free_;
+  if (node != kNil) {
+    free_ = Left(node);
+    nodes_[node] = Node{key, kNil | kRedBit, kNil};
+  } else {
+    if (nodes_.Size() >= MaxSize()) {
+      throw std::length_error("Requested Size exceeds the maximum Size.");
+    }
+    node = static_cast<index_type>(nodes_.Size());
+    nodes_.PushBack(Node{key, kNil | kRedBit, kNil});
+  }
+  ++size_;
+  return node;
+}
+
+template <typename Key>
+void CompactSet<Key>::FreeNode(index_type node) {
+  // Свободный узел не должен держать ресурсы удалённого ключа
+  nodes_[node].key = Key();
+  nodes_[node].left = free_;
+  nodes_[node].right = kNil;
+  free_ = node;
+  --size_;
+}
+
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::RotateLeft(
+    index_type node) {
+  index_type x = Right(node);
+  SetRight(node, Left(x));
+  SetLeft(x, node);
+  SetRed(x, IsRed(node));
+  SetRed(node, true);
+  return x;
+}
+
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::RotateRight(
+    index_type node) {
+  index_type x = Left(node);
+  SetLeft(node, Right(x));
+  SetRight(x, node);
+  SetRed(x, IsRed(node));
+  SetRed(node, true);
+  return x;
+}
+
+template <typename Key>
+void CompactSet<Key>::FlipColors(index_type node) {
+  SetRed(node, !IsRed(node));
+  SetRed(Left(node), !IsRed(Left(node)));
+  SetRed(Right(node), !IsRed(Right(node)));
+}
+
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::MoveRedLeft(
+    index_type node) {
+  FlipColors(node);
+  if (IsRed(Left(Right(node)))) {
+    SetRight(node, RotateRight(Right(node)));
+    node = RotateLeft(node);
+    FlipColors(node);
+  }
+  return node;
+}
+
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::MoveRedRight(
+    index_type node) {
+  FlipColors(node);
+  if (IsRed(Left(Left(node)))) {
+    node = RotateRight(node);
+    FlipColors(node);
+  }
+  return node;
+}
+
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::Balance(
+    index_type node) {
+  if (IsRed(Right(node)) && !IsRed(Left(node))) node = RotateLeft(node);
+  if (IsRed(Left(node)) && IsRed(Left(Left(node)))) node = RotateRight(node);
+  if (IsRed(Left(node)) && IsRed(Right(node))) FlipColors(node);
+  return node;
+}
+
+/*
+ * Вставка и удаление рекурсивны, но глубина рекурсии ограничена высотой
+ * сбалансированного дерева. NewNode может перевыделить массив узлов, поэтому
+ * между вызовами хранятся только индексы.
+ *
+ * Вставка попутно собирает путь к своему узлу для итератора: на обратном
+ * ходе каждый уровень дописывает себя в path, а повороты правят его вершину.
+ */
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::InsertHelper(
+    index_type node, const Key& key, bool& inserted, InsertPath& path) {
+  if (node == kNil) {
+    inserted = true;
+    node = NewNode(key);
+    path.nodes[path.size++] = node;
+    return node;
+  }
+  if (key < nodes_[node].key) {
+    SetLeft(node, InsertHelper(Left(node), key, inserted, path));
+  } else if (nodes_[node].key < key) {
+    SetRight(node, InsertHelper(Right(node), key, inserted, path));
+  } else {
+    path.nodes[path.size++] = node;
+    return node;
+  }
+  path.nodes[path.size++] = node;
+  // То же, что Balance, но с правкой пути
+  if (IsRed(Right(node)) && !IsRed(Left(node))) {
+    node = TrackRotation(RotateLeft(node), path);
+  }
+  if (IsRed(Left(node)) && IsRed(Left(Left(node)))) {
+    node = TrackRotation(RotateRight(node), path);
+  }
+  if (IsRed(Left(node)) && IsRed(Right(node))) FlipColors(node);
+  return node;
+}
+
+/*
+ * До поворота путь начинался с old; поворот поднимает над ним его ребёнка
+ * top, а внутренний внук top переходит к old. Если top не лежал на пути, он
+ * становится новой вершиной. Иначе old либо выпадает из пути, либо, если
+ * путь шёл через внутреннего внука, меняется с top местами.
+ */
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::TrackRotation(
+    index_type top, InsertPath& path) const {
+  index_type* last = path.nodes + path.size - 1;
+  index_type old = *last;
+  if (path.size < 2 || last[-1] != top) {
+    path.nodes[path.size++] = top;
+  } else if (path.size >= 3 &&
+             (Left(old) == last[-2] || Right(old) == last[-2])) {
+    last[-1] = old;
+    *last = top;
+  } else {
+    --path.size;
+  }
+  return top;
+}
+
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::EraseHelper(
+    index_type node, const Key& key) {
+  if (key < nodes_[node].key) {
+    if (!IsRed(Left(node)) && !IsRed(Left(Left(node)))) {
+      node = MoveRedLeft(node);
+    }
+    SetLeft(node, EraseHelper(Left(node), key));
+  } else {
+    if (IsRed(Left(node))) node = RotateRight(node);
+    if (!(nodes_[node].key < key) && Right(node) == kNil) {
+      FreeNode(node);
+      return kNil;
+    }
+    if (!IsRed(Right(node)) && !IsRed(Left(Right(node)))) {
+      node = MoveRedRight(node);
+    }
+    if (!(nodes_[node].key < key)) {
+      index_type min = Right(node);
+      while (Left(min) != kNil) min = Left(min);
+      nodes_[node].key = std::move(nodes_[min].key);
+      SetRight(node, EraseMin(Right(node)));
+    } else {
+      SetRight(node, EraseHelper(Right(node), key));
+    }
+  }
+  return Balance(node);
+}
+
+template <typename Key>
+typename CompactSet<Key>::index_type CompactSet<Key>::EraseMin(
+    index_type node) {
+  if (Left(node) == kNil) {
+    FreeNode(node);
+    return kNil;
+  }
+  if (!IsRed(Left(node)) && !IsRed(Left(Left(node)))) {
+    node = MoveRedLeft(node);
+  }
+  SetLeft(node, EraseMin(Left(node)));
+  return Balance(node);
+}
+
+// Работа с итераторами
+template <typename Key>
+void CompactSet<Key>::Iterator::PushLeftmost(index_type node) {
+  while (node != kNil) {
+    path_[depth_++] = node;
+    node = set_->Left(node);
+  }
+}
+
+template <typename Key>
+void CompactSet<Key>::Iterator::PushRightmost(index_type node) {
+  while (node != kNil) {
+    path_[depth_++] = node;
+    node = set_->Right(node);
+  }
+}
+
+template <typename Key>
+const Key& CompactSet<Key>::Iterator::operator*() const {
+  return set_->nodes_.Data()[path_[depth_ - 1]].key;
+}
+
+template <typename Key>
+const Key* CompactSet<Key>::Iterator::operator->() const {
+  return &**this;
+}
+
+template <typename Key>
+typename CompactSet<Key>::Iterator& CompactSet<Key>::Iterator::operator++() {
+  if (depth_ == 0) return *this;
+  index_type right = set_->Right(path_[depth_ - 1]);
+  if (right != kNil) {
+    PushLeftmost(right);
+  } else {
+    index_type child;
+    do {
+      child = path_[--depth_];
+    } while (depth_ > 0 && set_->Right(path_[depth_ - 1]) == child);
+  }
+  return *this;
+}
+
+template <typename Key>
+typename CompactSet<Key>::Iterator& CompactSet<Key>::Iterator::operator--() {
+  if (depth_ == 0) {
+    PushRightmost(set_->root_);
+    return *this;
+  }
+  index_type left = set_->Left(path_[depth_ - 1]);
+  if (left != kNil) {
+    PushRightmost(left);
+  } else {
+    index_type child;
+    do {
+      child = path_[--depth_];
+    } while (depth_ > 0 && set_->Left(path_[depth_ - 1]) == child);
+  }
+  return *this;
+}
+
+template <typename Key>
+bool CompactSet<Key>::Iterator::operator==(const Iterator& other) const {
+  if (depth_ == 0 || other.depth_ == 0) return depth_ == other.depth_;
+  return path_[depth_ - 1] == other.path_[other.depth_ - 1];
+}
+
+template <typename Key>
+bool CompactSet<Key>::Iterator::operator!=(const Iterator& other) const {
+  return !(*this == other);
+}
+
+}  // namespace s21
+
+#endif  // SRC_COMPACT_SET_S21_COMPACT_SET_TPP_
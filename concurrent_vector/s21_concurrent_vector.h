@@ -0,0 +1,141 @@
+#ifndef SRC_CONCURRENT_VECTOR_S21_CONCURRENT_VECTOR_H_
+#define SRC_CONCURRENT_VECTOR_S21_CONCURRENT_VECTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/s21_allocator.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * Вектор, в конец которого можно добавлять из многих потоков без
+ * блокировок. Память — цепочка кусков: k-й кусок вмещает kFirstChunk << k
+ * элементов, поэтому элементы никогда не перемещаются, а номер куска
+ * вычисляется по старшему биту индекса. Место под элементы занимается
+ * одним fetch_add, кусок выделяет первый дошедший до него поток (CAS;
+ * проигравший освобождает свой, не тронув его страниц).
+ *
+ * Элемент считается опубликованным, когда его конструктор завершился: у
+ * каждого элемента есть байт готовности, который пишется с release.
+ * Байт, а не бит в общем слове, потому что запись байта — обычный store, а
+ * бит пришлось бы ставить вторым атомарным fetch_or.
+ * Читать можно только опубликованные элементы — свой индекс, полученный
+ * от PushBack, или любой, для которого IsPublished вернул true. Если
+ * конструктор бросил исключение, место остаётся пустым и не публикуется.
+ *
+ * Freeze, Clear и деструктор нельзя вызывать одновременно с другими
+ * операциями.
+ */
+template <typename T>
+class ConcurrentVector {
+ public:
+  using valueType = T;
+  using reference = T &;
+  using constReference = const T &;
+  using sizeType = size_t;
+
+  static constexpr sizeType kFirstShift = 6;
+  static constexpr sizeType kFirstChunk = sizeType{1} << kFirstShift;
+
+  ConcurrentVector() = default;
+  ConcurrentVector(const ConcurrentVector &) = delete;
+  ConcurrentVector &operator=(const ConcurrentVector &) = delete;
+  ~ConcurrentVector();
+
+  // Возвращают индекс добавленного элемента
+  sizeType PushBack(constReference value);
+  sizeType PushBack(valueType &&value);
+  template <typename... Args>
+  sizeType EmplaceBack(Args &&...args);
+  // Добавляет n копий value подряд и возвращает индекс первой
+  sizeType GrowBy(sizeType n, constReference value = valueType());
+
+  // Без проверки: элемент должен быть опубликован
+  reference operator[](sizeType pos);
+  constReference operator[](sizeType pos) const;
+  // Бросает out_of_range, если элемент не опубликован
+  reference At(sizeType pos);
+  constReference At(sizeType pos) const;
+  bool IsPublished(sizeType pos) const;
+
+  // Число занятых мест, включая ещё не опубликованные
+  sizeType Size() const;
+  bool Empty() const;
+  sizeType MaxSize() const;
+  // Заранее выделяет куски под первые n элементов; потокобезопасен
+  void Reserve(sizeType n);
+
+  // Переносит опубликованные элементы по порядку в Vector и очищает себя
+  Vector<valueType> Freeze();
+  void Clear();
+
+ private:
+  static constexpr sizeType kMaxChunks = 57;
+
+  using Flag = std::atomic<uint8_t>;
+  static_assert(std::is_trivially_default_constructible_v<Flag>,
+                "ready flags are taken from calloc'ed memory");
+
+  struct FreeFlags {
+    void operator()(Flag *flags) const { std::free(flags); }
+  };
+
+  /*
+   * Байты готовности берутся из calloc: большой блок приходит из mmap уже
+   * обнулённым, и его страницы не трогаются, пока в них не пишут. Поэтому
+   * кусок, проигравший CAS в EnsureChunk, освобождается, так и не заняв
+   * физической памяти, даже если до куска одновременно дошли многие потоки.
+   */
+  struct Chunk {
+    explicit Chunk(sizeType n)
+        : ready(AllocateFlags(n)),
+          data(HeapAllocator<T>::Allocate(n)),
+          size(n) {}
+    ~Chunk() { HeapAllocator<T>::Deallocate(data, size); }
+
+    static Flag *AllocateFlags(sizeType n) {
+      void *flags = std::calloc(n, sizeof(Flag));
+      if (!flags) throw std::bad_alloc();
+      return static_cast<Flag *>(flags);
+    }
+
+    std::unique_ptr<Flag[], FreeFlags> ready;
+    T *data;
+    sizeType size;
+  };
+
+  struct Location {
+    sizeType chunk;
+    sizeType offset;
+  };
+
+  static Location Locate(sizeType pos);
+  static sizeType ChunkSize(sizeType chunk);
+  sizeType Claim(sizeType n);
+  Chunk *EnsureChunk(sizeType chunk);
+  static void Publish(Chunk *chunk, sizeType first, sizeType last);
+  // Вызывает fn для опубликованных элементов куска по порядку
+  template <typename Function>
+  static void ForEachPublished(Chunk *chunk, Function fn);
+
+  std::atomic<Chunk *> chunks_[kMaxChunks] = {};
+  // На своей линии кэша, чтобы fetch_add не мешал читать chunks_
+  alignas(64) std::atomic<sizeType> size_{0};
+};
+
+}  // namespace s21
+
+#include "s21_concurrent_vector.tpp"
+
+#endif  // SRC_CONCURRENT_VECTOR_S21_CONCURRENT_VECTOR_H_
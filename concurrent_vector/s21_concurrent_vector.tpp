@@ -0,0 +1,205 @@
+#ifndef SRC_CONCURRENT_VECTOR_S21_CONCURRENT_VECTOR_TPP_
+#define SRC_CONCURRENT_VECTOR_S21_CONCURRENT_VECTOR_TPP_
+
+namespace s21 {
+
+template <typename T>
+ConcurrentVector<T>::~ConcurrentVector() {
+  Clear();
+}
+
+template <typename T>
+typename ConcurrentVector<T>::sizeType ConcurrentVector<T>::PushBack(
+    constReference value) {
+  return EmplaceBack(value);
+}
+
+template <typename T>
+typename ConcurrentVector<T>::sizeType ConcurrentVector<T>::PushBack(
+    valueType &&value) {
+  return EmplaceBack(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename ConcurrentVector<T>::sizeType ConcurrentVector<T>::EmplaceBack(
+    Args &&...args) {
+  sizeType pos = Claim(1);
+  Location location = Locate(pos);
+  Chunk *chunk = EnsureChunk(location.chunk);
+  new (chunk->data + location.offset) T(std::forward<Args>(args)...);
+  Publish(chunk, location.offset, location.offset + 1);
+  return pos;
+}
+
+template <typename T>
+typename ConcurrentVector<T>::sizeType ConcurrentVector<T>::GrowBy(
+    sizeType n, constReference value) {
+  sizeType first = Claim(n);
+  for (sizeType pos = first, end = first + n; pos < end;) {
+    Location location = Locate(pos);
+    Chunk *chunk = EnsureChunk(location.chunk);
+    sizeType count = std::min(end - pos, chunk->size - location.offset);
+    std::uninitialized_fill_n(chunk->data + location.offset, count, value);
+    Publish(chunk, location.offset, location.offset + count);
+    pos += count;
+  }
+  return first;
+}
+
+template <typename T>
+typename ConcurrentVector<T>::reference ConcurrentVector<T>::operator[](
+    sizeType pos) {
+  Location location = Locate(pos);
+  return chunks_[location.chunk].load(std::memory_order_acquire)
+      ->data[location.offset];
+}
+
+template <typename T>
+typename ConcurrentVector<T>::constReference ConcurrentVector<T>::operator[](
+    sizeType pos) const {
+  Location location = Locate(pos);
+  return chunks_[location.chunk].load(std::memory_order_acquire)
+      ->data[location.offset];
+}
+
+template <typename T>
+typename ConcurrentVector<T>::reference ConcurrentVector<T>::At(
+    sizeType pos) {
+  if (!IsPublished(pos)) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <typename T>
+typename ConcurrentVector<T>::constReference ConcurrentVector<T>::At(
+    sizeType pos) const {
+  if (!IsPublished(pos)) throw std::out_of_range("Index out of range");
+  return (*this)[pos];
+}
+
+template <typename T>
+bool ConcurrentVector<T>::IsPublished(sizeType pos) const {
+  if (pos >= Size()) return false;
+  Location location = Locate(pos);
+  Chunk *chunk = chunks_[location.chunk].load(std::memory_order_acquire);
+  if (!chunk) return false;
+  return chunk->ready[location.offset].load(std::memory_order_acquire) != 0;
+}
+
+template <typename T>
+typename ConcurrentVector<T>::sizeType ConcurrentVector<T>::Size() const {
+  return std::min(size_.load(std::memory_order_acquire), MaxSize());
+}
+
+template <typename T>
+bool ConcurrentVector<T>::Empty() const {
+  return Size() == 0;
+}
+
+template <typename T>
+typename ConcurrentVector<T>::sizeType ConcurrentVector<T>::MaxSize() const {
+  sizeType capacity = kFirstChunk * ((sizeType{1} << kMaxChunks) - 1);
+  sizeType bytes =
+      static_cast<sizeType>(std::numeric_limits<std::ptrdiff_t>::max()) /
+      sizeof(T);
+  return std::min(capacity, bytes);
+}
+
+template <typename T>
+void ConcurrentVector<T>::Reserve(sizeType n) {
+  if (n > MaxSize()) {
+    throw std::length_error("Requested Size exceeds the maximum Size.");
+  }
+  for (sizeType chunk = 0, covered = 0; covered < n; ++chunk) {
+    EnsureChunk(chunk);
+    covered += ChunkSize(chunk);
+  }
+}
+
+template <typename T>
+Vector<T> ConcurrentVector<T>::Freeze() {
+  Vector<T> result;
+  result.Reserve(Size());
+  for (sizeType i = 0; i < kMaxChunks; ++i) {
+    Chunk *chunk = chunks_[i].load(std::memory_order_acquire);
+    if (!chunk) continue;
+    ForEachPublished(chunk, [&result](T &value) {
+      result.PushBack(std::move(value));
+    });
+  }
+  Clear();
+  return result;
+}
+
+template <typename T>
+void ConcurrentVector<T>::Clear() {
+  for (sizeType i = 0; i < kMaxChunks; ++i) {
+    Chunk *chunk = chunks_[i].exchange(nullptr, std::memory_order_acq_rel);
+    if (!chunk) continue;
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      ForEachPublished(chunk, [](T &value) { std::destroy_at(&value); });
+    }
+    delete chunk;
+  }
+  size_.store(0, std::memory_order_release);
+}
+
+template <typename T>
+typename ConcurrentVector<T>::Location ConcurrentVector<T>::Locate(
+    sizeType pos) {
+  // Куски вместе с воображаемым префиксом из kFirstChunk элементов образуют
+  // степени двойки: старший бит pos + kFirstChunk и есть номер куска
+  sizeType shifted = pos + kFirstChunk;
+  sizeType high = 63 - static_cast<sizeType>(__builtin_clzll(shifted));
+  return {high - kFirstShift, shifted - (sizeType{1} << high)};
+}
+
+template <typename T>
+typename ConcurrentVector<T>::sizeType ConcurrentVector<T>::ChunkSize(
+    sizeType chunk) {
+  return kFirstChunk << chunk;
+}
+
+template <typename T>
+typename ConcurrentVector<T>::sizeType ConcurrentVector<T>::Claim(
+    sizeType n) {
+  sizeType first = size_.fetch_add(n, std::memory_order_relaxed);
+  if (first > MaxSize() || n > MaxSize() - first) {
+    throw std::length_error("Requested Size exceeds the maximum Size.");
+  }
+  return first;
+}
+
+template <typename T>
+typename ConcurrentVector<T>::Chunk *ConcurrentVector<T>::EnsureChunk(
+    sizeType chunk) {
+  Chunk *current = chunks_[chunk].load(std::memory_order_acquire);
+  if (current) return current;
+  auto fresh = std::make_unique<Chunk>(ChunkSize(chunk));
+  if (chunks_[chunk].compare_exchange_strong(current, fresh.get(),
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+    return fresh.release();
+  }
+  return current;
+}
+
+template <typename T>
+void ConcurrentVector<T>::Publish(Chunk *chunk, sizeType first,
+                                  sizeType last) {
+  for (; first < last; ++first) {
+    chunk->ready[first].store(1, std::memory_order_release);
+  }
+}
+
+template <typename T>
+template <typename Function>
+void ConcurrentVector<T>::ForEachPublished(Chunk *chunk, Function fn) {
+  for (sizeType i = 0; i < chunk->size; ++i) {
+    if (chunk->ready[i].load(std::memory_order_acquire)) fn(chunk->data[i]);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONCURRENT_VECTOR_S21_CONCURRENT_VECTOR_TPP_
@@ -0,0 +1,241 @@
+#ifndef SRC_DEQUE_S21_DEQUE_H_
+#define SRC_DEQUE_S21_DEQUE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/s21_allocator.h"
+
+namespace s21 {
+
+/*
+ * Двусторонняя очередь из блоков фиксированного размера. Карта блоков —
+ * массив указателей, в котором занятые блоки лежат подряд; элемент с
+ * номером i находится в блоке (start + i) / kBlockSize, поэтому доступ по
+ * индексу стоит один сдвиг и одну маску. Вставка и удаление с концов
+ * амортизированно O(1): новый блок выделяется раз в kBlockSize вставок, а
+ * при нехватке места в карте она центрируется или удваивается.
+ *
+ * Элементы никогда не перемещаются, поэтому ссылки и указатели на них
+ * остаются верными при вставке и удалении с концов (кроме ссылок на
+ * удалённые элементы). Итераторы хранят указатель в карту и становятся
+ * недействительными после вставки. Один освободившийся блок остаётся в
+ * запасе, чтобы очередь, которая то растёт, то пустеет на границе блока,
+ * не выделяла память каждый раз.
+ */
+template <typename T>
+class Deque {
+ public:
+  template <bool kConst>
+  class DequeIterator;
+
+  using valueType = T;
+  using reference = T &;
+  using constReference = const T &;
+  using iterator = DequeIterator<false>;
+  using constIterator = DequeIterator<true>;
+  using sizeType = size_t;
+
+ private:
+  // Около 4 КиБ на блок, но не меньше 16 элементов; степень двойки
+  static constexpr sizeType BlockSizeFor() {
+    sizeType size = 16;
+    while (size * 2 * sizeof(T) <= 4096) size *= 2;
+    return size;
+  }
+
+ public:
+  static constexpr sizeType kBlockSize = BlockSizeFor();
+
+  template <bool kConst>
+  class DequeIterator {
+    using Value = std::conditional_t<kConst, const T, T>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = Value &;
+    using pointer = Value *;
+
+    DequeIterator() = default;
+    DequeIterator(T *const *node, sizeType offset)
+        : node_(node), offset_(offset) {}
+    // iterator неявно приводится к constIterator
+    template <bool kFromMutable = !kConst,
+              typename = std::enable_if_t<kFromMutable>>
+    operator DequeIterator<true>() const {
+      return {node_, offset_};
+    }
+
+    reference operator*() const { return (*node_)[offset_]; }
+    pointer operator->() const { return *node_ + offset_; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    DequeIterator &operator++() {
+      if (++offset_ == kBlockSize) {
+        ++node_;
+        offset_ = 0;
+      }
+      return *this;
+    }
+    DequeIterator operator++(int) {
+      DequeIterator old = *this;
+      ++*this;
+      return old;
+    }
+    DequeIterator &operator--() {
+      if (offset_ == 0) {
+        --node_;
+        offset_ = kBlockSize;
+      }
+      --offset_;
+      return *this;
+    }
+    DequeIterator operator--(int) {
+      DequeIterator old = *this;
+      --*this;
+      return old;
+    }
+    DequeIterator &operator+=(difference_type n) {
+      difference_type block = static_cast<difference_type>(kBlockSize);
+      difference_type pos = static_cast<difference_type>(offset_) + n;
+      difference_type nodes =
+          pos >= 0 ? pos / block : -((-pos - 1) / block) - 1;
+      node_ += nodes;
+      offset_ = static_cast<sizeType>(pos - nodes * block);
+      return *this;
+    }
+    DequeIterator &operator-=(difference_type n) { return *this += -n; }
+    DequeIterator operator+(difference_type n) const {
+      DequeIterator result = *this;
+      return result += n;
+    }
+    DequeIterator operator-(difference_type n) const {
+      DequeIterator result = *this;
+      return result -= n;
+    }
+    difference_type operator-(const DequeIterator &other) const {
+      return (node_ - other.node_) *
+                 static_cast<difference_type>(kBlockSize) +
+             static_cast<difference_type>(offset_) -
+             static_cast<difference_type>(other.offset_);
+    }
+
+    bool operator==(const DequeIterator &other) const {
+      return node_ == other.node_ && offset_ == other.offset_;
+    }
+    bool operator!=(const DequeIterator &other) const {
+      return !(*this == other);
+    }
+    bool operator<(const DequeIterator &other) const {
+      return *this - other < 0;
+    }
+    bool operator>(const DequeIterator &other) const { return other < *this; }
+    bool operator<=(const DequeIterator &other) const {
+      return !(other < *this);
+    }
+    bool operator>=(const DequeIterator &other) const {
+      return !(*this < other);
+    }
+
+   private:
+    T *const *node_ = nullptr;
+    sizeType offset_ = 0;
+  };
+
+  Deque() = default;
+  explicit Deque(sizeType n);
+  Deque(std::initializer_list<valueType> const &items);
+  Deque(const Deque &d);
+  Deque(Deque &&d) noexcept;
+  ~Deque();
+
+  Deque &operator=(const Deque &d);
+  Deque &operator=(Deque &&d) noexcept;
+
+  void Swap(Deque &other);
+
+  reference At(sizeType pos);
+  constReference At(sizeType pos) const;
+  reference operator[](sizeType pos);
+  constReference operator[](sizeType pos) const;
+
+  reference Front();
+  reference Back();
+  constReference Front() const;
+  constReference Back() const;
+
+  iterator Begin();
+  iterator End();
+  constIterator Begin() const;
+  constIterator End() const;
+
+  /*
+   * Вызывает fn(first, last) для каждого непрерывного участка элементов по
+   * порядку. Внутренний цикл по указателям компилятор может
+   * векторизовать, чего не бывает при обходе итератором.
+   */
+  template <typename Function>
+  void ForEachBlock(Function fn);
+  template <typename Function>
+  void ForEachBlock(Function fn) const;
+
+  bool Empty() const;
+  sizeType Size() const;
+  sizeType MaxSize() const;
+
+  // Освобождает запасной блок
+  void ShrinkToFit();
+  void Clear();
+
+  void PushBack(constReference value);
+  void PushBack(valueType &&value);
+  void PushFront(constReference value);
+  void PushFront(valueType &&value);
+
+  template <typename... Args>
+  reference EmplaceBack(Args &&...args);
+  template <typename... Args>
+  reference EmplaceFront(Args &&...args);
+
+  void PopBack();
+  void PopFront();
+
+ private:
+  static constexpr sizeType kShift = [] {
+    sizeType shift = 0;
+    while ((sizeType{1} << shift) < kBlockSize) ++shift;
+    return shift;
+  }();
+  static constexpr sizeType kMask = kBlockSize - 1;
+
+  T *Slot(sizeType global) const;
+  T *NewBlock();
+  void ReleaseBlock(sizeType block);
+  void GrowMap(bool at_front);
+  void CheckNotEmpty() const;
+
+  // Карта блоков, занятые блоки — с start_ / kBlockSize по последний элемент
+  T **map_ = nullptr;
+  sizeType map_size_ = 0;
+  // Сквозной номер первого элемента: блок start_ >> kShift, ячейка в нём
+  // start_ & kMask
+  sizeType start_ = 0;
+  sizeType size_ = 0;
+  T *spare_ = nullptr;
+};
+
+}  // namespace s21
+
+#include "s21_deque.tpp"
+
+#endif  // SRC_DEQUE_S21_DEQUE_H_
@@ -0,0 +1,349 @@
+#ifndef SRC_DEQUE_S21_DEQUE_TPP_
+#define SRC_DEQUE_S21_DEQUE_TPP_
+
+namespace s21 {
+
+template <typename T>
+Deque<T>::Deque(sizeType n) : Deque() {
+  for (sizeType i = 0; i < n; ++i) {
+    EmplaceBack();
+  }
+}
+
+template <typename T>
+Deque<T>::Deque(std::initializer_list<valueType> const &items) : Deque() {
+  for (const valueType &item : items) {
+    PushBack(item);
+  }
+}
+
+template <typename T>
+Deque<T>::Deque(const Deque &d) : Deque() {
+  d.ForEachBlock([this](const T *first, const T *last) {
+    for (; first != last; ++first) {
+      PushBack(*first);
+    }
+  });
+}
+
+template <typename T>
+Deque<T>::Deque(Deque &&d) noexcept
+    : map_(std::exchange(d.map_, nullptr)),
+      map_size_(std::exchange(d.map_size_, 0)),
+      start_(std::exchange(d.start_, 0)),
+      size_(std::exchange(d.size_, 0)),
+      spare_(std::exchange(d.spare_, nullptr)) {}
+
+template <typename T>
+Deque<T>::~Deque() {
+  Clear();
+  ShrinkToFit();
+  delete[] map_;
+}
+
+template <typename T>
+Deque<T> &Deque<T>::operator=(const Deque &d) {
+  if (this != &d) {
+    Deque copy(d);
+    Swap(copy);
+  }
+  return *this;
+}
+
+template <typename T>
+Deque<T> &Deque<T>::operator=(Deque &&d) noexcept {
+  if (this != &d) {
+    Deque moved(std::move(d));
+    Swap(moved);
+  }
+  return *this;
+}
+
+template <typename T>
+void Deque<T>::Swap(Deque &other) {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+  std::swap(spare_, other.spare_);
+}
+
+template <typename T>
+typename Deque<T>::reference Deque<T>::At(sizeType pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return *Slot(start_ + pos);
+}
+
+template <typename T>
+typename Deque<T>::constReference Deque<T>::At(sizeType pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return *Slot(start_ + pos);
+}
+
+template <typename T>
+typename Deque<T>::reference Deque<T>::operator[](sizeType pos) {
+  return *Slot(start_ + pos);
+}
+
+template <typename T>
+typename Deque<T>::constReference Deque<T>::operator[](sizeType pos) const {
+  return *Slot(start_ + pos);
+}
+
+template <typename T>
+typename Deque<T>::reference Deque<T>::Front() {
+  CheckNotEmpty();
+  return *Slot(start_);
+}
+
+template <typename T>
+typename Deque<T>::reference Deque<T>::Back() {
+  CheckNotEmpty();
+  return *Slot(start_ + size_ - 1);
+}
+
+template <typename T>
+typename Deque<T>::constReference Deque<T>::Front() const {
+  CheckNotEmpty();
+  return *Slot(start_);
+}
+
+template <typename T>
+typename Deque<T>::constReference Deque<T>::Back() const {
+  CheckNotEmpty();
+  return *Slot(start_ + size_ - 1);
+}
+
+template <typename T>
+typename Deque<T>::iterator Deque<T>::Begin() {
+  return iterator(map_ + (start_ >> kShift), start_ & kMask);
+}
+
+template <typename T>
+typename Deque<T>::iterator Deque<T>::End() {
+  sizeType end = start_ + size_;
+  return iterator(map_ + (end >> kShift), end & kMask);
+}
+
+template <typename T>
+typename Deque<T>::constIterator Deque<T>::Begin() const {
+  return constIterator(map_ + (start_ >> kShift), start_ & kMask);
+}
+
+template <typename T>
+typename Deque<T>::constIterator Deque<T>::End() const {
+  sizeType end = start_ + size_;
+  return constIterator(map_ + (end >> kShift), end & kMask);
+}
+
+template <typename T>
+template <typename Function>
+void Deque<T>::ForEachBlock(Function fn) {
+  sizeType end = start_ + size_;
+  for (sizeType global = start_; global < end;) {
+    sizeType block_end = std::min(end, (global | kMask) + 1);
+    T *first = Slot(global);
+    fn(first, first + (block_end - global));
+    global = block_end;
+  }
+}
+
+template <typename T>
+template <typename Function>
+void Deque<T>::ForEachBlock(Function fn) const {
+  sizeType end = start_ + size_;
+  for (sizeType global = start_; global < end;) {
+    sizeType block_end = std::min(end, (global | kMask) + 1);
+    const T *first = Slot(global);
+    fn(first, first + (block_end - global));
+    global = block_end;
+  }
+}
+
+template <typename T>
+bool Deque<T>::Empty() const {
+  return size_ == 0;
+}
+
+template <typename T>
+typename Deque<T>::sizeType Deque<T>::Size() const {
+  return size_;
+}
+
+template <typename T>
+typename Deque<T>::sizeType Deque<T>::MaxSize() const {
+  return static_cast<sizeType>(std::numeric_limits<std::ptrdiff_t>::max()) /
+         sizeof(T);
+}
+
+template <typename T>
+void Deque<T>::ShrinkToFit() {
+  if (spare_) {
+    HeapAllocator<T>::Deallocate(spare_, kBlockSize);
+    spare_ = nullptr;
+  }
+}
+
+template <typename T>
+void Deque<T>::Clear() {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    ForEachBlock([](T *first, T *last) { std::destroy(first, last); });
+  }
+  if (size_ > 0) {
+    sizeType last = (start_ + size_ - 1) >> kShift;
+    for (sizeType block = start_ >> kShift; block <= last; ++block) {
+      ReleaseBlock(block);
+    }
+  }
+  size_ = 0;
+  start_ = (map_size_ / 2) << kShift;
+}
+
+template <typename T>
+void Deque<T>::PushBack(constReference value) {
+  EmplaceBack(value);
+}
+
+template <typename T>
+void Deque<T>::PushBack(valueType &&value) {
+  EmplaceBack(std::move(value));
+}
+
+template <typename T>
+void Deque<T>::PushFront(constReference value) {
+  EmplaceFront(value);
+}
+
+template <typename T>
+void Deque<T>::PushFront(valueType &&value) {
+  EmplaceFront(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename Deque<T>::reference Deque<T>::EmplaceBack(Args &&...args) {
+  if (!map_ || start_ + size_ == map_size_ << kShift) GrowMap(false);
+  sizeType global = start_ + size_;
+  sizeType block = global >> kShift;
+  bool fresh = map_[block] == nullptr;
+  if (fresh) map_[block] = NewBlock();
+  T *slot = map_[block] + (global & kMask);
+  try {
+    new (slot) T(std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) ReleaseBlock(block);
+    throw;
+  }
+  ++size_;
+  return *slot;
+}
+
+template <typename T>
+template <typename... Args>
+typename Deque<T>::reference Deque<T>::EmplaceFront(Args &&...args) {
+  if (!map_ || start_ == 0) GrowMap(true);
+  sizeType global = start_ - 1;
+  sizeType block = global >> kShift;
+  bool fresh = map_[block] == nullptr;
+  if (fresh) map_[block] = NewBlock();
+  T *slot = map_[block] + (global & kMask);
+  try {
+    new (slot) T(std::forward<Args>(args)...);
+  } catch (...) {
+    if (fresh) ReleaseBlock(block);
+    throw;
+  }
+  start_ = global;
+  ++size_;
+  return *slot;
+}
+
+template <typename T>
+void Deque<T>::PopBack() {
+  CheckNotEmpty();
+  sizeType global = start_ + size_ - 1;
+  std::destroy_at(Slot(global));
+  --size_;
+  if (size_ == 0 || (global & kMask) == 0) ReleaseBlock(global >> kShift);
+  if (size_ == 0) start_ = (map_size_ / 2) << kShift;
+}
+
+template <typename T>
+void Deque<T>::PopFront() {
+  CheckNotEmpty();
+  sizeType global = start_;
+  std::destroy_at(Slot(global));
+  ++start_;
+  --size_;
+  if (size_ == 0 || (start_ & kMask) == 0) ReleaseBlock(global >> kShift);
+  if (size_ == 0) start_ = (map_size_ / 2) << kShift;
+}
+
+template <typename T>
+T *Deque<T>::Slot(sizeType global) const {
+  return map_[global >> kShift] + (global & kMask);
+}
+
+template <typename T>
+T *Deque<T>::NewBlock() {
+  if (spare_) return std::exchange(spare_, nullptr);
+  return HeapAllocator<T>::Allocate(kBlockSize);
+}
+
+template <typename T>
+void Deque<T>::ReleaseBlock(sizeType block) {
+  T *data = std::exchange(map_[block], nullptr);
+  if (!spare_) {
+    spare_ = data;
+  } else {
+    HeapAllocator<T>::Deallocate(data, kBlockSize);
+  }
+}
+
+/*
+ * Освобождает место под один блок перед первым (at_front) или после
+ * последнего занятого. Если занятые блоки занимают не больше половины
+ * карты, они сдвигаются к её середине, иначе карта удваивается. Так
+ * очередь, которая растёт с одного конца и убывает с другого, двигает
+ * указатели блоков амортизированно O(1) раз на блок.
+ */
+template <typename T>
+void Deque<T>::GrowMap(bool at_front) {
+  sizeType first = start_ >> kShift;
+  sizeType used = size_ == 0 ? 0 : ((start_ + size_ - 1) >> kShift) - first + 1;
+  sizeType needed = used + 1;
+  sizeType new_first = 0;
+  if (needed * 2 <= map_size_) {
+    new_first = (map_size_ - needed) / 2 + (at_front ? 1 : 0);
+    if (new_first < first) {
+      std::copy(map_ + first, map_ + first + used, map_ + new_first);
+    } else {
+      std::copy_backward(map_ + first, map_ + first + used,
+                         map_ + new_first + used);
+    }
+    for (sizeType block = first; block < first + used; ++block) {
+      if (block < new_first || block >= new_first + used) {
+        map_[block] = nullptr;
+      }
+    }
+  } else {
+    sizeType new_size = std::max<sizeType>(8, map_size_ * 2);
+    while (new_size < needed * 2) new_size *= 2;
+    T **new_map = new T *[new_size]();
+    new_first = (new_size - needed) / 2 + (at_front ? 1 : 0);
+    std::copy(map_ + first, map_ + first + used, new_map + new_first);
+    delete[] map_;
+    map_ = new_map;
+    map_size_ = new_size;
+  }
+  start_ = (new_first << kShift) + (start_ & kMask);
+}
+
+template <typename T>
+void Deque<T>::CheckNotEmpty() const {
+  if (size_ == 0) throw std::out_of_range("Deque is empty");
+}
+
+}  // namespace s21
+
+#endif  // SRC_DEQUE_S21_DEQUE_TPP_
@@ -2,10 +2,12 @@
 #define S21_LIST_H_
 
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
+#include <utility>
 
 namespace s21 {
 template <typename T>
@@ -64,7 +66,14 @@ class List {
   void Clear();
 
   void PushBack(const_reference value);
+  void PushBack(value_type&& value);
   void PushFront(const_reference value);
+  void PushFront(value_type&& value);
+
+  template <typename... Args>
+  reference EmplaceBack(Args&&... args);
+  template <typename... Args>
+  reference EmplaceFront(Args&&... args);
 
   void PopBack();
   void PopFront();
@@ -78,10 +87,17 @@ class List {
   const_iterator Cbegin() const;
   const_iterator Cend() const;
 
+  // Устойчивая сортировка слиянием за O(n log n): перецепляет узлы, не
+  // копируя и не перемещая значения
   void Sort();
+  template <typename Compare>
+  void Sort(Compare comp);
   void Unique();
 
   iterator Insert(ListIterator pos, const_reference value);
+  iterator Insert(ListIterator pos, value_type&& value);
+  template <typename... Args>
+  iterator Emplace(ListIterator pos, Args&&... args);
   void Erase(ListIterator pos);
   void Merge(List& other);
   void Splice(const_iterator pos, List& other);
@@ -105,8 +121,20 @@ class List {
         : data(value),
           next(nullptr),
           previous(nullptr) {}  // конструктор класса Node
+    // значение создаётся прямо в узле из аргументов конструктора T
+    template <typename... Args>
+    Node(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), next(nullptr), previous(nullptr) {}
   };
 
+  // Сливает отсортированные цепочки по next в left; при исключении из comp
+  // все узлы остаются одной цепочкой в left
+  template <typename Compare>
+  static void MergeChains(Node*& left, Node* right, Compare& comp);
+  static Node* ConcatChains(Node* first, Node* second);
+  // Восстанавливает previous, head_ и tail_ по цепочке next
+  void Relink(Node* first);
+
   Node* head_;      // первый
   Node* tail_;      // последний
   size_type size_;  // размер
@@ -8,7 +8,7 @@ List<T>::List() : head_(nullptr), tail_(nullptr), size_(0) {}
 template <typename T>
 List<T>::List(size_type n) : head_(nullptr), tail_(nullptr), size_(0) {
   for (size_type i = 0; i < n; ++i) {
-    PushBack(0);
+    EmplaceBack();
   }
 }
 
@@ -130,7 +130,28 @@ void List<T>::Clear() {
 
 template <typename T>
 void List<T>::PushBack(const_reference value) {
-  Node* newNode = new Node(value);
+  EmplaceBack(value);
+}
+
+template <typename T>
+void List<T>::PushBack(value_type&& value) {
+  EmplaceBack(std::move(value));
+}
+
+template <typename T>
+void List<T>::PushFront(const_reference value) {
+  EmplaceFront(value);
+}
+
+template <typename T>
+void List<T>::PushFront(value_type&& value) {
+  EmplaceFront(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename List<T>::reference List<T>::EmplaceBack(Args&&... args) {
+  Node* newNode = new Node(std::in_place, std::forward<Args>(args)...);
   if (tail_ == nullptr) {
     head_ = tail_ = newNode;
   } else {
@@ -139,11 +160,13 @@ void List<T>::PushBack(const_reference value) {
     tail_ = newNode;
   }
   ++size_;
+  return newNode->data;
 }
 
 template <typename T>
-void List<T>::PushFront(const_reference value) {
-  Node* newNode = new Node(value);
+template <typename... Args>
+typename List<T>::reference List<T>::EmplaceFront(Args&&... args) {
+  Node* newNode = new Node(std::in_place, std::forward<Args>(args)...);
   if (head_ == nullptr) {
     head_ = tail_ = newNode;
   } else {
@@ -152,6 +175,7 @@ void List<T>::PushFront(const_reference value) {
     head_ = newNode;
   }
   ++size_;
+  return newNode->data;
 }
 
 template <typename T>
@@ -231,16 +255,49 @@ typename List<T>::const_iterator List<T>::Cend() const {
 
 template <typename T>
 void List<T>::Sort() {
-  for (size_type i = 0; i < size_ - 1; ++i) {
-    Node* current = head_;
-    Node* next = head_->next;
-    for (size_type j = 0; j < size_ - 1 - i; ++j) {
-      if (current->data > next->data) {
-        std::swap(current->data, next->data);
+  Sort(std::less<>());
+}
+
+/*
+ * Восходящая сортировка слиянием. bins[i] — отсортированная цепочка из
+ * 2^i узлов или пустая: очередной узел сливается с bins[0], bins[1], ...,
+ * пока не найдётся пустая ячейка, как при прибавлении единицы к двоичному
+ * счётчику. В ячейках с меньшим номером лежат более поздние узлы, поэтому
+ * они всегда сливаются правым операндом, и сортировка устойчива.
+ */
+template <typename T>
+template <typename Compare>
+void List<T>::Sort(Compare comp) {
+  if (size_ < 2) return;
+  Node* bins[std::numeric_limits<size_type>::digits] = {};
+  Node* rest = head_;
+  try {
+    while (rest) {
+      Node* carry = rest;
+      rest = rest->next;
+      carry->next = nullptr;
+      size_type i = 0;
+      for (; bins[i]; ++i) {
+        MergeChains(bins[i], carry, comp);
+        carry = bins[i];
+        bins[i] = nullptr;
       }
-      current = next;
-      next = current->next;
+      bins[i] = carry;
+    }
+    Node* sorted = nullptr;
+    for (Node*& bin : bins) {
+      if (!bin) continue;
+      MergeChains(bin, sorted, comp);
+      sorted = bin;
+      bin = nullptr;
     }
+    Relink(sorted);
+  } catch (...) {
+    // Порядок не определён, но все узлы остаются в списке
+    Node* all = rest;
+    for (Node* bin : bins) all = ConcatChains(bin, all);
+    Relink(all);
+    throw;
   }
 }
 
@@ -259,16 +316,27 @@ void List<T>::Unique() {
 template <typename T>
 typename List<T>::iterator List<T>::Insert(iterator pos,
                                            const_reference value) {
+  return Emplace(pos, value);
+}
+
+template <typename T>
+typename List<T>::iterator List<T>::Insert(iterator pos, value_type&& value) {
+  return Emplace(pos, std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename List<T>::iterator List<T>::Emplace(iterator pos, Args&&... args) {
   if (pos == End()) {
-    PushBack(value);
+    EmplaceBack(std::forward<Args>(args)...);
     return iterator(tail_);
   } else if (pos == Begin()) {
-    PushFront(value);
+    EmplaceFront(std::forward<Args>(args)...);
     return iterator(head_);
   }
 
   Node* currentNode = pos.current_;
-  Node* newNode = new Node(value);
+  Node* newNode = new Node(std::in_place, std::forward<Args>(args)...);
 
   newNode->next = currentNode;
   newNode->previous = currentNode->previous;
@@ -346,6 +414,52 @@ void List<T>::InsertManyFront(Args&&... args) {
   }
 }
 
+template <typename T>
+template <typename Compare>
+void List<T>::MergeChains(Node*& left, Node* right, Compare& comp) {
+  Node* result = nullptr;
+  Node** link = &result;
+  try {
+    while (left && right) {
+      // При равенстве первым идёт левый узел
+      if (comp(right->data, left->data)) {
+        *link = right;
+        right = right->next;
+      } else {
+        *link = left;
+        left = left->next;
+      }
+      link = &(*link)->next;
+    }
+  } catch (...) {
+    *link = ConcatChains(left, right);
+    left = result;
+    throw;
+  }
+  *link = left ? left : right;
+  left = result;
+}
+
+template <typename T>
+typename List<T>::Node* List<T>::ConcatChains(Node* first, Node* second) {
+  if (!first) return second;
+  Node* last = first;
+  while (last->next) last = last->next;
+  last->next = second;
+  return first;
+}
+
+template <typename T>
+void List<T>::Relink(Node* first) {
+  head_ = first;
+  Node* previous = nullptr;
+  for (Node* node = first; node; node = node->next) {
+    node->previous = previous;
+    previous = node;
+  }
+  tail_ = previous;
+}
+
 }  // namespace s21
 
 #endif
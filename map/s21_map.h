@@ -107,6 +107,31 @@ class Map : public BinaryTreeBase<Key, T> {
   bool Empty() const { return BinaryTreeBase<Key, T>::Empty(); }
 
   void Clear() { BinaryTreeBase<Key, T>::Clear(); }
+
+  // Делит словарь на ключи меньше key и остальные, словарь становится пустым
+  std::pair<Map, Map> Split(const Key &key) {
+    std::pair<Map, Map> parts;
+    this->SplitInto(key, parts.first, parts.second);
+    return parts;
+  }
+
+  // Склеивает словари, все ключи left должны быть меньше ключей right
+  static Map Join(Map &&left, Map &&right) {
+    Map result;
+    result.JoinFrom(left, right, true);
+    return result;
+  }
+
+  // Параллельный обход: fn(const Key &, T &) для каждой пары
+  template <typename Function>
+  void ParallelForEach(Function fn,
+                       size_t threads = std::thread::hardware_concurrency()) {
+    this->ParallelForEachNode(
+        [&fn](Node *node) {
+          fn(static_cast<const Key &>(node->key), node->value);
+        },
+        threads);
+  }
 };
 
 }  // namespace s21
@@ -0,0 +1,175 @@
+#ifndef SRC_MAPPED_VECTOR_S21_MAPPED_VECTOR_H_
+#define SRC_MAPPED_VECTOR_S21_MAPPED_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/s21_growth_policy.h"
+
+namespace s21 {
+
+// Подсказки ядру о порядке обращений, передаются в madvise
+enum class MapAdvice { kNormal, kSequential, kRandom, kWillNeed };
+
+template <typename T>
+class ConstMappedVector;
+
+/*
+ * Вектор тривиально копируемых T, элементы которого лежат в файле,
+ * отображённом в память через mmap. Данные переживают перезапуск и могут
+ * быть больше оперативной памяти: страницы подгружает и выгружает ядро.
+ *
+ * Файл начинается с 64-байтного заголовка (сигнатура, sizeof(T) и число
+ * элементов), за ним идут Capacity() элементов. Рост ёмкости делается через
+ * ftruncate и mremap. Размер записывается в заголовок при Sync() и в
+ * деструкторе. Для чтения без изменений есть ConstMappedVector.
+ *
+ * Ошибки системных вызовов сообщаются через std::system_error, файл
+ * с чужим заголовком или другим sizeof(T) — через std::runtime_error.
+ */
+template <typename T, typename Growth = GrowByDoubling>
+class MappedVector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "MappedVector stores T as raw bytes in a file");
+  static_assert(alignof(T) <= 64, "MappedVector aligns data to 64 bytes");
+
+ public:
+  using valueType = T;
+  using reference = T &;
+  using constReference = const T &;
+  using iterator = T *;
+  using constIterator = const T *;
+  using sizeType = size_t;
+
+  explicit MappedVector(const std::string &path);
+  MappedVector(const MappedVector &) = delete;
+  MappedVector(MappedVector &&v) noexcept;
+  ~MappedVector();
+
+  MappedVector &operator=(const MappedVector &) = delete;
+  MappedVector &operator=(MappedVector &&v) noexcept;
+
+  void Swap(MappedVector &other);
+
+  reference At(sizeType pos);
+  constReference At(sizeType pos) const;
+  reference operator[](sizeType pos);
+  constReference operator[](sizeType pos) const;
+
+  reference Front();
+  reference Back();
+  constReference Front() const;
+  constReference Back() const;
+
+  iterator Data();
+  iterator Begin();
+  iterator End();
+
+  constIterator Data() const;
+  constIterator Begin() const;
+  constIterator End() const;
+
+  bool Empty() const;
+  sizeType Size() const;
+  sizeType MaxSize() const;
+
+  void Reserve(sizeType size);
+  sizeType Capacity() const;
+  // Обрезает файл до Size() элементов
+  void ShrinkToFit();
+  void Clear();
+
+  iterator Insert(iterator pos, constReference value);
+  iterator Erase(iterator pos);
+  iterator Erase(iterator first, iterator last);
+
+  void PushBack(constReference value);
+  template <typename... Args>
+  reference EmplaceBack(Args &&...args);
+  void PopBack();
+
+  // Записывает размер в заголовок и сбрасывает изменённые страницы на диск
+  void Sync();
+  void Advise(MapAdvice advice) const;
+
+ private:
+  friend class ConstMappedVector<T>;
+
+  struct Header {
+    char magic[8];
+    uint64_t element_size;
+    uint64_t size;
+  };
+
+  static constexpr sizeType kHeaderBytes = 64;
+  static constexpr char kMagic[8] = {'s', '2', '1', 'm', 'v', 'e', 'c', '1'};
+
+  // Открывает существующий файл только для чтения
+  MappedVector(const std::string &path, bool read_only);
+
+  T *Elements() const;
+  void WriteHeader();
+  void MapFile(sizeType bytes);
+  void Remap(sizeType capacity);
+  void Release() noexcept;
+
+  int fd_ = -1;
+  char *base_ = nullptr;
+  sizeType mapped_bytes_ = 0;
+  sizeType size_ = 0;
+  sizeType capacity_ = 0;
+  bool read_only_ = false;
+};
+
+/*
+ * MappedVector, открытый только для чтения. Открытие лишь отображает файл,
+ * ничего не читая, поэтому не зависит от его размера. Страницы отображения
+ * защищены от записи, и доступ к элементам есть только константный.
+ */
+template <typename T>
+class ConstMappedVector {
+ public:
+  using valueType = T;
+  using constReference = const T &;
+  using constIterator = const T *;
+  using sizeType = size_t;
+
+  explicit ConstMappedVector(const std::string &path);
+
+  constReference At(sizeType pos) const;
+  constReference operator[](sizeType pos) const;
+  constReference Front() const;
+  constReference Back() const;
+
+  constIterator Data() const;
+  constIterator Begin() const;
+  constIterator End() const;
+
+  bool Empty() const;
+  sizeType Size() const;
+  void Advise(MapAdvice advice) const;
+
+ private:
+  MappedVector<T> vector_;
+};
+
+}  // namespace s21
+
+#include "s21_mapped_vector.tpp"
+
+#endif  // SRC_MAPPED_VECTOR_S21_MAPPED_VECTOR_H_
@@ -0,0 +1,439 @@
+#ifndef SRC_MAPPED_VECTOR_S21_MAPPED_VECTOR_TPP_
+#define SRC_MAPPED_VECTOR_S21_MAPPED_VECTOR_TPP_
+
+namespace s21 {
+
+template <typename T, typename Growth>
+MappedVector<T, Growth>::MappedVector(const std::string &path)
+    : MappedVector(path, false) {}
+
+template <typename T, typename Growth>
+MappedVector<T, Growth>::MappedVector(const std::string &path, bool read_only)
+    : read_only_(read_only) {
+  fd_ = read_only_ ? open(path.c_str(), O_RDONLY | O_CLOEXEC)
+                   : open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (fd_ < 0) {
+    throw std::system_error(errno, std::generic_category(), "open " + path);
+  }
+  try {
+    struct stat info;
+    if (fstat(fd_, &info) != 0) {
+      throw std::system_error(errno, std::generic_category(), "fstat " + path);
+    }
+    sizeType bytes = static_cast<sizeType>(info.st_size);
+    if (bytes == 0 && !read_only_) {
+      // Новый файл: только заголовок, ёмкость нулевая
+      if (ftruncate(fd_, kHeaderBytes) != 0) {
+        throw std::system_error(errno, std::generic_category(), "ftruncate");
+      }
+      MapFile(kHeaderBytes);
+      WriteHeader();
+      return;
+    }
+    if (bytes < kHeaderBytes) {
+      throw std::runtime_error("Not a MappedVector file: " + path);
+    }
+    MapFile(bytes);
+    Header header;
+    std::memcpy(&header, base_, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.element_size != sizeof(T)) {
+      throw std::runtime_error("File holds other records: " + path);
+    }
+    capacity_ = (bytes - kHeaderBytes) / sizeof(T);
+    if (header.size > capacity_) {
+      throw std::runtime_error("File is truncated: " + path);
+    }
+    size_ = header.size;
+  } catch (...) {
+    // Заголовок чужого файла не перезаписываем
+    read_only_ = true;
+    Release();
+    throw;
+  }
+}
+
+template <typename T, typename Growth>
+MappedVector<T, Growth>::MappedVector(MappedVector &&v) noexcept
+    : fd_(std::exchange(v.fd_, -1)),
+      base_(std::exchange(v.base_, nullptr)),
+      mapped_bytes_(std::exchange(v.mapped_bytes_, 0)),
+      size_(std::exchange(v.size_, 0)),
+      capacity_(std::exchange(v.capacity_, 0)),
+      read_only_(v.read_only_) {}
+
+template <typename T, typename Growth>
+MappedVector<T, Growth>::~MappedVector() {
+  Release();
+}
+
+template <typename T, typename Growth>
+MappedVector<T, Growth> &MappedVector<T, Growth>::operator=(
+    MappedVector &&v) noexcept {
+  if (this != &v) {
+    Release();
+    Swap(v);
+  }
+  return *this;
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::Swap(MappedVector &other) {
+  std::swap(fd_, other.fd_);
+  std::swap(base_, other.base_);
+  std::swap(mapped_bytes_, other.mapped_bytes_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(read_only_, other.read_only_);
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::reference MappedVector<T, Growth>::At(
+    sizeType pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return Elements()[pos];
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::constReference MappedVector<T, Growth>::At(
+    sizeType pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return Elements()[pos];
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::reference
+MappedVector<T, Growth>::operator[](sizeType pos) {
+  return Elements()[pos];
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::constReference
+MappedVector<T, Growth>::operator[](sizeType pos) const {
+  return Elements()[pos];
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::reference MappedVector<T, Growth>::Front() {
+  if (Empty()) throw std::out_of_range("MappedVector is empty");
+  return Elements()[0];
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::reference MappedVector<T, Growth>::Back() {
+  if (Empty()) throw std::out_of_range("MappedVector is empty");
+  return Elements()[size_ - 1];
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::constReference
+MappedVector<T, Growth>::Front() const {
+  if (Empty()) throw std::out_of_range("MappedVector is empty");
+  return Elements()[0];
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::constReference
+MappedVector<T, Growth>::Back() const {
+  if (Empty()) throw std::out_of_range("MappedVector is empty");
+  return Elements()[size_ - 1];
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::Data() {
+  return Elements();
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::Begin() {
+  return Elements();
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::End() {
+  return Elements() + size_;
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::constIterator MappedVector<T, Growth>::Data()
+    const {
+  return Elements();
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::constIterator
+MappedVector<T, Growth>::Begin() const {
+  return Elements();
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::constIterator MappedVector<T, Growth>::End()
+    const {
+  return Elements() + size_;
+}
+
+template <typename T, typename Growth>
+bool MappedVector<T, Growth>::Empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::sizeType MappedVector<T, Growth>::Size()
+    const {
+  return size_;
+}
+
+// Размер файла ограничен off_t
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::sizeType MappedVector<T, Growth>::MaxSize()
+    const {
+  return (static_cast<sizeType>(std::numeric_limits<off_t>::max()) -
+          kHeaderBytes) /
+         sizeof(T);
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::Reserve(sizeType size) {
+  if (size > MaxSize()) {
+    throw std::length_error("Requested Size exceeds the maximum Size.");
+  }
+  if (size > capacity_) Remap(size);
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::sizeType MappedVector<T, Growth>::Capacity()
+    const {
+  return capacity_;
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::ShrinkToFit() {
+  if (capacity_ > size_) Remap(size_);
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::Clear() {
+  size_ = 0;
+}
+
+// Элементы тривиально копируемые, поэтому хвост сдвигается одним memmove
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::Insert(
+    iterator pos, constReference value) {
+  sizeType index = pos - Elements();
+  // Копия до роста: value может ссылаться на старое отображение
+  T copy = value;
+  EmplaceBack(copy);
+  T *data = Elements();
+  std::memmove(data + index + 1, data + index,
+               (size_ - 1 - index) * sizeof(T));
+  data[index] = copy;
+  return data + index;
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::Erase(
+    iterator pos) {
+  return Erase(pos, pos + 1);
+}
+
+template <typename T, typename Growth>
+typename MappedVector<T, Growth>::iterator MappedVector<T, Growth>::Erase(
+    iterator first, iterator last) {
+  std::memmove(first, last, (End() - last) * sizeof(T));
+  size_ -= last - first;
+  return first;
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::PushBack(constReference value) {
+  EmplaceBack(value);
+}
+
+// Элемент создаётся до роста: аргумент может ссылаться на старое отображение
+template <typename T, typename Growth>
+template <typename... Args>
+typename MappedVector<T, Growth>::reference
+MappedVector<T, Growth>::EmplaceBack(Args &&...args) {
+  T value(std::forward<Args>(args)...);
+  if (size_ == capacity_) {
+    if (size_ == MaxSize()) {
+      throw std::length_error("Requested Size exceeds the maximum Size.");
+    }
+    Remap(std::min(Growth::Next(capacity_, size_ + 1), MaxSize()));
+  }
+  T *slot = new (Elements() + size_) T(value);
+  ++size_;
+  return *slot;
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::PopBack() {
+  if (Empty()) throw std::out_of_range("MappedVector is empty");
+  --size_;
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::Sync() {
+  WriteHeader();
+  if (msync(base_, mapped_bytes_, MS_SYNC) != 0) {
+    throw std::system_error(errno, std::generic_category(), "msync");
+  }
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::Advise(MapAdvice advice) const {
+  int flag = MADV_NORMAL;
+  switch (advice) {
+    case MapAdvice::kSequential:
+      flag = MADV_SEQUENTIAL;
+      break;
+    case MapAdvice::kRandom:
+      flag = MADV_RANDOM;
+      break;
+    case MapAdvice::kWillNeed:
+      flag = MADV_WILLNEED;
+      break;
+    default:
+      break;
+  }
+  if (madvise(base_, mapped_bytes_, flag) != 0) {
+    throw std::system_error(errno, std::generic_category(), "madvise");
+  }
+}
+
+template <typename T, typename Growth>
+T *MappedVector<T, Growth>::Elements() const {
+  return reinterpret_cast<T *>(base_ + kHeaderBytes);
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::WriteHeader() {
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.element_size = sizeof(T);
+  header.size = size_;
+  std::memcpy(base_, &header, sizeof(header));
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::MapFile(sizeType bytes) {
+  int protection = read_only_ ? PROT_READ : PROT_READ | PROT_WRITE;
+  void *data = mmap(nullptr, bytes, protection, MAP_SHARED, fd_, 0);
+  if (data == MAP_FAILED) {
+    throw std::system_error(errno, std::generic_category(), "mmap");
+  }
+  base_ = static_cast<char *>(data);
+  mapped_bytes_ = bytes;
+}
+
+/*
+ * Файл удлиняется до переотображения, а укорачивается после, чтобы
+ * отображение никогда не выходило за конец файла. На Linux mremap
+ * переносит таблицы страниц без копирования данных.
+ */
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::Remap(sizeType capacity) {
+  sizeType bytes = kHeaderBytes + capacity * sizeof(T);
+  bool grows = bytes > mapped_bytes_;
+  if (grows && ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+    throw std::system_error(errno, std::generic_category(), "ftruncate");
+  }
+#if defined(__linux__)
+  void *moved = mremap(base_, mapped_bytes_, bytes, MREMAP_MAYMOVE);
+  if (moved == MAP_FAILED) {
+    throw std::system_error(errno, std::generic_category(), "mremap");
+  }
+  base_ = static_cast<char *>(moved);
+  mapped_bytes_ = bytes;
+#else
+  munmap(base_, mapped_bytes_);
+  base_ = nullptr;
+  MapFile(bytes);
+#endif
+  if (!grows && ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+    throw std::system_error(errno, std::generic_category(), "ftruncate");
+  }
+  capacity_ = capacity;
+}
+
+template <typename T, typename Growth>
+void MappedVector<T, Growth>::Release() noexcept {
+  if (base_) {
+    if (!read_only_) WriteHeader();
+    munmap(base_, mapped_bytes_);
+    base_ = nullptr;
+  }
+  if (fd_ >= 0) {
+    close(fd_);
+    fd_ = -1;
+  }
+  mapped_bytes_ = 0;
+  size_ = 0;
+  capacity_ = 0;
+}
+
+template <typename T>
+ConstMappedVector<T>::ConstMappedVector(const std::string &path)
+    : vector_(path, true) {}
+
+template <typename T>
+typename ConstMappedVector<T>::constReference ConstMappedVector<T>::At(
+    sizeType pos) const {
+  return vector_.At(pos);
+}
+
+template <typename T>
+typename ConstMappedVector<T>::constReference
+ConstMappedVector<T>::operator[](sizeType pos) const {
+  return vector_[pos];
+}
+
+template <typename T>
+typename ConstMappedVector<T>::constReference ConstMappedVector<T>::Front()
+    const {
+  return vector_.Front();
+}
+
+template <typename T>
+typename ConstMappedVector<T>::constReference ConstMappedVector<T>::Back()
+    const {
+  return vector_.Back();
+}
+
+template <typename T>
+typename ConstMappedVector<T>::constIterator ConstMappedVector<T>::Data()
+    const {
+  return vector_.Data();
+}
+
+template <typename T>
+typename ConstMappedVector<T>::constIterator ConstMappedVector<T>::Begin()
+    const {
+  return vector_.Begin();
+}
+
+template <typename T>
+typename ConstMappedVector<T>::constIterator ConstMappedVector<T>::End()
+    const {
+  return vector_.End();
+}
+
+template <typename T>
+bool ConstMappedVector<T>::Empty() const {
+  return vector_.Empty();
+}
+
+template <typename T>
+typename ConstMappedVector<T>::sizeType ConstMappedVector<T>::Size() const {
+  return vector_.Size();
+}
+
+template <typename T>
+void ConstMappedVector<T>::Advise(MapAdvice advice) const {
+  vector_.Advise(advice);
+}
+
+}  // namespace s21
+
+#endif  // SRC_MAPPED_VECTOR_S21_MAPPED_VECTOR_TPP_
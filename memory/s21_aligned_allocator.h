@@ -0,0 +1,47 @@
+#ifndef SRC_MEMORY_S21_ALIGNED_ALLOCATOR_H_
+#define SRC_MEMORY_S21_ALIGNED_ALLOCATOR_H_
+
+#include <cstddef>
+#include <new>
+
+namespace s21 {
+
+/*
+ * Выделяет память с выравниванием Alignment (32 для AVX2, 64 для AVX-512)
+ * и округляет размер блока до целого числа Alignment, так что последний
+ * векторный регистр всегда читается внутри блока. RoundCapacity сообщает
+ * Vector, сколько элементов реально помещается в такой блок, и ёмкость
+ * вектора становится кратной ширине вектора.
+ */
+template <typename T, std::size_t Alignment = 64>
+struct AlignedAllocator {
+  static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0,
+                "Alignment must be a power of two not less than alignof(T)");
+
+  using valueType = T;
+
+  static T* Allocate(std::size_t n) {
+    if (n == 0) return nullptr;
+    return static_cast<T*>(
+        ::operator new(PaddedBytes(n), std::align_val_t(Alignment)));
+  }
+
+  static void Deallocate(T* data, std::size_t n) {
+    (void)n;
+    if (data) ::operator delete(data, std::align_val_t(Alignment));
+  }
+
+  static std::size_t RoundCapacity(std::size_t n) {
+    if (Alignment % sizeof(T) != 0) return n;
+    return PaddedBytes(n) / sizeof(T);
+  }
+
+ private:
+  static std::size_t PaddedBytes(std::size_t n) {
+    return (n * sizeof(T) + Alignment - 1) / Alignment * Alignment;
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_MEMORY_S21_ALIGNED_ALLOCATOR_H_
@@ -0,0 +1,66 @@
+#ifndef SRC_MEMORY_S21_ALLOCATOR_H_
+#define SRC_MEMORY_S21_ALLOCATOR_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+/*
+ * Распределители памяти для Vector. Выделяют сырую память под n объектов
+ * без их создания; Deallocate получает ту же ёмкость n, что и Allocate.
+ * Распределитель может дополнительно предоставить
+ *   static T* Reallocate(T* data, size_t old_n, size_t new_n);
+ * который меняет размер блока без копирования и возвращает новый адрес
+ * или nullptr, если это невозможно (старый блок остаётся в силе), и
+ *   static size_t RoundCapacity(size_t n);
+ * который округляет запрошенную ёмкость вверх до того, что реально
+ * помещается в выделяемый блок.
+ */
+template <typename T>
+struct HeapAllocator {
+  using valueType = T;
+
+  static T* Allocate(std::size_t n) {
+    if (n == 0) return nullptr;
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      return static_cast<T*>(
+          ::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    } else {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+  }
+
+  static void Deallocate(T* data, std::size_t n) {
+    (void)n;
+    if (!data) return;
+    if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      ::operator delete(data, std::align_val_t(alignof(T)));
+    } else {
+      ::operator delete(data);
+    }
+  }
+};
+
+template <typename Allocator, typename = void>
+struct CanReallocate : std::false_type {};
+
+template <typename Allocator>
+struct CanReallocate<Allocator,
+                     std::void_t<decltype(Allocator::Reallocate(
+                         std::declval<typename Allocator::valueType*>(),
+                         std::size_t{}, std::size_t{}))>> : std::true_type {};
+
+template <typename Allocator, typename = void>
+struct CanRoundCapacity : std::false_type {};
+
+template <typename Allocator>
+struct CanRoundCapacity<
+    Allocator, std::void_t<decltype(Allocator::RoundCapacity(std::size_t{}))>>
+    : std::true_type {};
+
+}  // namespace s21
+
+#endif  // SRC_MEMORY_S21_ALLOCATOR_H_
@@ -0,0 +1,107 @@
+#ifndef SRC_MEMORY_S21_BUFFER_OPS_H_
+#define SRC_MEMORY_S21_BUFFER_OPS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "s21_relocate.h"
+
+namespace s21 {
+
+/*
+ * Операции над элементами непрерывного буфера: живые элементы занимают
+ * [data, data + size), дальше до ёмкости лежит сырая память. Их общий код
+ * для Vector и SmallVector: контейнер хранит указатель, размер и ёмкость и
+ * решает, когда расти, а сдвиг элементов, перенос в новый блок и поведение
+ * при исключениях описаны здесь один раз.
+ */
+
+/*
+ * Создаёт элемент из args на месте position < size, сдвигая хвост на одно
+ * место вправо; после буфера должно быть свободное место.
+ */
+template <typename T, typename... Args>
+void EmplaceShifting(T* data, std::size_t& size, std::size_t position,
+                     Args&&... args) {
+  // элемент создаётся до сдвига: аргументы могут ссылаться внутрь буфера
+  T value(std::forward<Args>(args)...);
+  T* end = data + size;
+  new (end) T(std::move(*(end - 1)));
+  ++size;
+  std::move_backward(data + position, end - 1, end);
+  data[position] = std::move(value);
+}
+
+/*
+ * Вставляет count элементов [first, last) на место position, сдвигая хвост
+ * один раз; после буфера должно быть count свободных мест. Диапазон не
+ * должен указывать внутрь самого буфера. size растёт по мере создания
+ * элементов в сырой памяти, поэтому при исключении он их учитывает.
+ */
+template <typename T, typename ForwardIt>
+void InsertShifting(T* data, std::size_t& size, std::size_t position,
+                    ForwardIt first, ForwardIt last, std::size_t count) {
+  T* pos = data + position;
+  T* old_end = data + size;
+  std::size_t tail = size - position;
+  if (tail > count) {
+    std::uninitialized_move(old_end - count, old_end, old_end);
+    size += count;
+    std::move_backward(pos, old_end - count, old_end);
+    std::copy(first, last, pos);
+  } else {
+    ForwardIt middle = std::next(first, tail);
+    std::uninitialized_copy(middle, last, old_end);
+    size += count - tail;
+    std::uninitialized_move(pos, old_end, data + size);
+    size += tail;
+    std::copy(first, middle, pos);
+  }
+}
+
+// Удаляет [first, last) сдвигом хвоста [last, end) и возвращает новый конец
+template <typename T>
+T* EraseShifting(T* first, T* last, T* end) {
+  T* new_end = MoveAssign(last, end, first);
+  DestroyRange(new_end, end);
+  return new_end;
+}
+
+/*
+ * Рост в новый блок. Выделяет capacity мест через Allocator, вызывает
+ * construct(place), который должен создать count новых элементов начиная
+ * с place = tmp + position, и переносит старые [data, data + size) вокруг
+ * них. Новые элементы создаются первыми: их аргументы могут ссылаться в
+ * старый буфер. Перенос копирует элементы, перемещение которых может
+ * бросить исключение, поэтому при исключении новый блок освобождается, а
+ * старый буфер не меняется. Возвращает новый блок; старый освобождает
+ * вызывающий.
+ */
+template <typename Allocator, typename T, typename Construct>
+T* GrowAround(T* data, std::size_t size, std::size_t position,
+              std::size_t count, std::size_t capacity, Construct construct) {
+  T* tmp = Allocator::Allocate(capacity);
+  try {
+    construct(tmp + position);
+  } catch (...) {
+    Allocator::Deallocate(tmp, capacity);
+    throw;
+  }
+  try {
+    UninitializedRelocateAround(data, data + position, data + size, tmp,
+                                count);
+  } catch (...) {
+    DestroyRange(tmp + position, tmp + position + count);
+    Allocator::Deallocate(tmp, capacity);
+    throw;
+  }
+  return tmp;
+}
+
+}  // namespace s21
+
+#endif  // SRC_MEMORY_S21_BUFFER_OPS_H_
@@ -0,0 +1,45 @@
+#ifndef SRC_MEMORY_S21_GROWTH_POLICY_H_
+#define SRC_MEMORY_S21_GROWTH_POLICY_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+/*
+ * Политики роста ёмкости для Vector. Next получает текущую ёмкость и
+ * минимально необходимую и возвращает новую ёмкость не меньше required;
+ * ограничение MaxSize проверяет сам вектор.
+ */
+
+// Удвоение: меньше всего перевыделений, до 2x лишней памяти
+struct GrowByDoubling {
+  static std::size_t Next(std::size_t capacity, std::size_t required) {
+    std::size_t next = capacity ? capacity * 2 : 1;
+    return next < required ? required : next;
+  }
+};
+
+// Рост в 1.5 раза: освобождённые блоки можно переиспользовать
+struct GrowByHalf {
+  static std::size_t Next(std::size_t capacity, std::size_t required) {
+    std::size_t next = capacity + capacity / 2;
+    if (next <= capacity) next = capacity + 1;
+    return next < required ? required : next;
+  }
+};
+
+// Рост на фиксированное число элементов: лишняя память не больше Chunk
+template <std::size_t Chunk>
+struct GrowByChunk {
+  static_assert(Chunk > 0, "GrowByChunk needs a positive chunk");
+
+  static std::size_t Next(std::size_t capacity, std::size_t required) {
+    std::size_t next = capacity + Chunk;
+    if (next < required) next = (required + Chunk - 1) / Chunk * Chunk;
+    return next;
+  }
+};
+
+}  // namespace s21
+
+#endif  // SRC_MEMORY_S21_GROWTH_POLICY_H_
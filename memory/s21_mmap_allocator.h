@@ -0,0 +1,88 @@
+#ifndef SRC_MEMORY_S21_MMAP_ALLOCATOR_H_
+#define SRC_MEMORY_S21_MMAP_ALLOCATOR_H_
+
+#include <cstddef>
+#include <new>
+
+#include "s21_allocator.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace s21 {
+
+/*
+ * Распределитель для очень больших векторов. Блоки от Threshold байт
+ * берутся напрямую у ядра через mmap (с просьбой использовать большие
+ * страницы), а рост такого блока делается через mremap: ядро переносит
+ * таблицы страниц, данные не копируются, и пиковое потребление памяти
+ * остаётся близким к итоговому размеру. Маленькие блоки выделяются как в
+ * HeapAllocator. Vector вызывает Reallocate только для тривиально
+ * перемещаемых T. Вне Linux распределитель ведёт себя как HeapAllocator.
+ */
+template <typename T, std::size_t Threshold = std::size_t{1} << 21>
+struct MmapAllocator {
+  using valueType = T;
+
+  static T* Allocate(std::size_t n) {
+#if defined(__linux__)
+    if (IsMapped(n)) {
+      void* data = mmap(nullptr, MappedBytes(n), PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (data == MAP_FAILED) throw std::bad_alloc();
+#if defined(MADV_HUGEPAGE)
+      madvise(data, MappedBytes(n), MADV_HUGEPAGE);
+#endif
+      return static_cast<T*>(data);
+    }
+#endif
+    return HeapAllocator<T>::Allocate(n);
+  }
+
+  static void Deallocate(T* data, std::size_t n) {
+    if (!data) return;
+#if defined(__linux__)
+    if (IsMapped(n)) {
+      munmap(data, MappedBytes(n));
+      return;
+    }
+#endif
+    HeapAllocator<T>::Deallocate(data, n);
+  }
+
+  // Меняет размер отображённого блока, адрес может измениться
+  static T* Reallocate(T* data, std::size_t old_n, std::size_t new_n) {
+#if defined(__linux__)
+    if (IsMapped(old_n) && IsMapped(new_n)) {
+      void* moved = mremap(data, MappedBytes(old_n), MappedBytes(new_n),
+                           MREMAP_MAYMOVE);
+      if (moved == MAP_FAILED) return nullptr;
+#if defined(MADV_HUGEPAGE)
+      madvise(moved, MappedBytes(new_n), MADV_HUGEPAGE);
+#endif
+      return static_cast<T*>(moved);
+    }
+#else
+    (void)data;
+    (void)old_n;
+    (void)new_n;
+#endif
+    return nullptr;
+  }
+
+ private:
+#if defined(__linux__)
+  static bool IsMapped(std::size_t n) { return n * sizeof(T) >= Threshold; }
+
+  static std::size_t MappedBytes(std::size_t n) {
+    static const std::size_t page = sysconf(_SC_PAGESIZE);
+    return (n * sizeof(T) + page - 1) / page * page;
+  }
+#endif
+};
+
+}  // namespace s21
+
+#endif  // SRC_MEMORY_S21_MMAP_ALLOCATOR_H_
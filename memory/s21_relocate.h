@@ -0,0 +1,134 @@
+#ifndef SRC_MEMORY_S21_RELOCATE_H_
+#define SRC_MEMORY_S21_RELOCATE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace s21 {
+
+/*
+ * Тип можно переместить в новую память побайтовым копированием, после чего
+ * исходный объект считается уничтоженным без вызова деструктора. По
+ * умолчанию это тривиально копируемые типы; для своих типов (например,
+ * владеющих указателем без ссылок на самих себя) признак можно включить
+ * специализацией:
+ *   template <>
+ *   struct s21::IsTriviallyRelocatable<MyType> : std::true_type {};
+ */
+template <typename T>
+struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+// Разрушает [first, last); для тривиально разрушаемых типов ничего не делает
+template <typename T>
+void DestroyRange(T* first, T* last) {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    std::destroy(first, last);
+  } else {
+    (void)first;
+    (void)last;
+  }
+}
+
+// Копирование [first, last) в сырую память dest
+template <typename T>
+T* UninitializedCopy(const T* first, const T* last, T* dest) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::size_t count = last - first;
+    if (count) std::memcpy(dest, first, count * sizeof(T));
+    return dest + count;
+  } else {
+    return std::uninitialized_copy(first, last, dest);
+  }
+}
+
+/*
+ * Создаёт в сырой памяти dest копии [first, last), перемещая их, только если
+ * перемещение не бросает исключений или копировать нельзя (как
+ * std::move_if_noexcept). При исключении созданное в dest разрушается, а
+ * исходные объекты остаются нетронутыми, кроме типов, которые можно только
+ * перемещать с исключениями.
+ */
+template <typename T>
+T* UninitializedMoveIfNoexcept(T* first, T* last, T* dest) {
+  if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                !std::is_copy_constructible_v<T>) {
+    return std::uninitialized_move(first, last, dest);
+  } else {
+    return std::uninitialized_copy(first, last, dest);
+  }
+}
+
+// Перенос [first, last) в сырую память dest, исходные объекты уничтожаются
+// после успешного переноса; гарантии при исключении как у
+// UninitializedMoveIfNoexcept
+template <typename T>
+T* UninitializedRelocate(T* first, T* last, T* dest) {
+  if constexpr (IsTriviallyRelocatable<T>::value) {
+    std::size_t count = last - first;
+    if (count) {
+      std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                  count * sizeof(T));
+    }
+    return dest + count;
+  } else {
+    T* result = UninitializedMoveIfNoexcept(first, last, dest);
+    std::destroy(first, last);
+    return result;
+  }
+}
+
+/*
+ * Переносит [first, last) в dest, оставляя перед элементом middle пропуск
+ * из gap мест (туда вставляются новые элементы). Источник уничтожается,
+ * только когда перенесены обе части, поэтому при исключении dest пуст, а
+ * источник не изменён.
+ */
+template <typename T>
+void UninitializedRelocateAround(T* first, T* middle, T* last, T* dest,
+                                 std::size_t gap) {
+  if constexpr (IsTriviallyRelocatable<T>::value) {
+    T* prefix_end = UninitializedRelocate(first, middle, dest);
+    UninitializedRelocate(middle, last, prefix_end + gap);
+  } else {
+    T* prefix_end = UninitializedMoveIfNoexcept(first, middle, dest);
+    try {
+      UninitializedMoveIfNoexcept(middle, last, prefix_end + gap);
+    } catch (...) {
+      std::destroy(dest, prefix_end);
+      throw;
+    }
+    std::destroy(first, last);
+  }
+}
+
+// Копирующее присваивание [first, last) в живые объекты, диапазоны могут
+// пересекаться, если dest левее first
+template <typename T>
+T* CopyAssign(const T* first, const T* last, T* dest) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::size_t count = last - first;
+    if (count) std::memmove(dest, first, count * sizeof(T));
+    return dest + count;
+  } else {
+    return std::copy(first, last, dest);
+  }
+}
+
+// Перемещающее присваивание, условия на пересечение как у CopyAssign
+template <typename T>
+T* MoveAssign(T* first, T* last, T* dest) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::size_t count = last - first;
+    if (count) std::memmove(dest, first, count * sizeof(T));
+    return dest + count;
+  } else {
+    return std::move(first, last, dest);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_MEMORY_S21_RELOCATE_H_
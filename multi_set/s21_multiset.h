@@ -38,23 +38,11 @@ class MultiSet : public BinaryTreeBase<Key, Key> {
         current = current->right;
       }
     }
-    new_node->parent = parent;
-    if (!parent) {
-      this->root_ = new_node;
-    } else if (key < parent->key) {
-      parent->left = new_node;
-    } else {
-      parent->right = new_node;
-    }
-    ++this->size_;
+    this->AttachNode(new_node, parent);
     return {Iterator(new_node, this), true};
   }
 
   std::pair<Iterator, bool> Insert(Key&& value) noexcept {
-    typename BinaryTreeBase<Key, Key>::Node* new_node =
-        new typename BinaryTreeBase<Key, Key>::Node(std::move(value),
-                                                    std::move(value));
-
     typename BinaryTreeBase<Key, Key>::Node* current = this->root_;
     typename BinaryTreeBase<Key, Key>::Node* parent = nullptr;
     while (current) {
@@ -65,15 +53,10 @@ class MultiSet : public BinaryTreeBase<Key, Key> {
         current = current->right;
       }
     }
-    new_node->parent = parent;
-    if (!parent) {
-      this->root_ = new_node;
-    } else if (value < parent->key) {
-      parent->left = new_node;
-    } else {
-      parent->right = new_node;
-    }
-    ++this->size_;
+    // ключ копируется раньше, чем значение забирает value
+    typename BinaryTreeBase<Key, Key>::Node* new_node =
+        new typename BinaryTreeBase<Key, Key>::Node(value, std::move(value));
+    this->AttachNode(new_node, parent);
     return {Iterator(new_node, this), true};
   }
 
@@ -119,16 +102,10 @@ class MultiSet : public BinaryTreeBase<Key, Key> {
     return BinaryTreeBase<Key, Key>::Contains(key);
   }
 
+  // Повороты могут развести равные ключи по разным поддеревьям, поэтому
+  // количество считается по рангам
   size_type Count(const Key& key) const {
-    size_type count = 0;
-    typename BinaryTreeBase<Key, Key>::Node* node = this->root_;
-    while (node) {
-      if (node->key == key) {
-        ++count;
-      }
-      node = (key < node->key) ? node->left : node->right;
-    }
-    return count;
+    return this->CountBelow(key, true) - this->CountBelow(key, false);
   }
 
   MultiSet& operator=(const MultiSet& other) {
@@ -146,6 +123,32 @@ class MultiSet : public BinaryTreeBase<Key, Key> {
   }
   bool Empty() const { return BinaryTreeBase<Key, Key>::Empty(); }
   size_t Size() const { return BinaryTreeBase<Key, Key>::Size(); }
+
+  // Делит мультимножество на ключи меньше key и остальные, мультимножество
+  // становится пустым
+  std::pair<MultiSet, MultiSet> Split(const Key& key) {
+    std::pair<MultiSet, MultiSet> parts;
+    this->SplitInto(key, parts.first, parts.second);
+    return parts;
+  }
+
+  // Склеивает мультимножества, ключи left не должны превышать ключи right
+  static MultiSet Join(MultiSet&& left, MultiSet&& right) {
+    MultiSet result;
+    result.JoinFrom(left, right, false);
+    return result;
+  }
+
+  // Параллельный обход: fn(const Key&) для каждого элемента
+  template <typename Function>
+  void ParallelForEach(Function fn,
+                       size_t threads = std::thread::hardware_concurrency()) {
+    this->ParallelForEachNode(
+        [&fn](typename BinaryTreeBase<Key, Key>::Node* node) {
+          fn(static_cast<const Key&>(node->key));
+        },
+        threads);
+  }
 };
 
 }  // namespace s21
@@ -0,0 +1,57 @@
+#ifndef SRC_PARALLEL_S21_PARALLEL_H_
+#define SRC_PARALLEL_S21_PARALLEL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "../thread_pool/s21_thread_pool.h"
+
+namespace s21 {
+namespace parallel {
+
+/*
+ * Параллельные алгоритмы над диапазонами с произвольным доступом: итераторы
+ * Vector и Array (обычные указатели), std::vector и т.п. Все функции
+ * принимают пул первым аргументом и возвращаются, когда работа закончена.
+ * Короткие диапазоны обрабатываются в вызывающем потоке.
+ */
+
+// Минимум элементов на одну задачу
+inline constexpr size_t kMinGrain = 1 << 14;
+// Максимум задач на один вызов Reduce/Transform/ForEach
+inline constexpr size_t kMaxChunks = 256;
+
+template <typename RandomIt, typename Compare = std::less<>>
+void Sort(ThreadPool &pool, RandomIt first, RandomIt last, Compare comp = {});
+
+// Равные элементы сохраняют исходный порядок
+template <typename RandomIt, typename Compare = std::less<>>
+void StableSort(ThreadPool &pool, RandomIt first, RandomIt last,
+                Compare comp = {});
+
+template <typename RandomIt, typename OutputIt, typename UnaryOp>
+OutputIt Transform(ThreadPool &pool, RandomIt first, RandomIt last,
+                   OutputIt d_first, UnaryOp op);
+
+template <typename RandomIt, typename Function>
+void ForEach(ThreadPool &pool, RandomIt first, RandomIt last, Function fn);
+
+/*
+ * Свёртка ассоциативной операцией op. Диапазон делится на части, число
+ * которых зависит только от длины диапазона, а частичные результаты
+ * сворачиваются слева направо начиная с init. Поэтому результат не зависит
+ * от числа потоков и порядка их работы, даже для float.
+ */
+template <typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+T Reduce(ThreadPool &pool, RandomIt first, RandomIt last, T init,
+         BinaryOp op = {});
+
+}  // namespace parallel
+}  // namespace s21
+
+#include "s21_parallel.tpp"
+
+#endif  // SRC_PARALLEL_S21_PARALLEL_H_
@@ -0,0 +1,120 @@
+#ifndef SRC_PARALLEL_S21_PARALLEL_TPP_
+#define SRC_PARALLEL_S21_PARALLEL_TPP_
+
+namespace s21 {
+namespace parallel {
+
+namespace detail {
+
+// Число частей для диапазона из size элементов, от размера пула не зависит
+inline size_t ChunkCount(size_t size) {
+  return std::clamp<size_t>(size / kMinGrain, 1, kMaxChunks);
+}
+
+// Начало части index из count для диапазона из size элементов
+inline size_t ChunkBegin(size_t size, size_t count, size_t index) {
+  return size / count * index + std::min(index, size % count);
+}
+
+/*
+ * Сортирует части параллельно и сливает соседние пары раундами, на каждом
+ * раунде ширина отсортированных блоков удваивается. inplace_merge
+ * устойчиво, поэтому устойчивость целиком определяется sort_chunk.
+ */
+template <typename RandomIt, typename Compare, typename ChunkSort>
+void MergeSort(ThreadPool &pool, RandomIt first, RandomIt last, Compare comp,
+               ChunkSort sort_chunk) {
+  size_t size = static_cast<size_t>(last - first);
+  size_t chunks = 1;
+  while (chunks < pool.Size() && size / (chunks * 2) >= kMinGrain) {
+    chunks *= 2;
+  }
+  if (chunks == 1) {
+    sort_chunk(first, last, comp);
+    return;
+  }
+  pool.ParallelFor(chunks, [&](size_t i) {
+    sort_chunk(first + ChunkBegin(size, chunks, i),
+               first + ChunkBegin(size, chunks, i + 1), comp);
+  });
+  for (size_t width = 1; width < chunks; width *= 2) {
+    pool.ParallelFor(chunks / (width * 2), [&](size_t pair) {
+      size_t left = pair * width * 2;
+      std::inplace_merge(first + ChunkBegin(size, chunks, left),
+                         first + ChunkBegin(size, chunks, left + width),
+                         first + ChunkBegin(size, chunks, left + width * 2),
+                         comp);
+    });
+  }
+}
+
+}  // namespace detail
+
+template <typename RandomIt, typename Compare>
+void Sort(ThreadPool &pool, RandomIt first, RandomIt last, Compare comp) {
+  detail::MergeSort(pool, first, last, comp,
+                    [](RandomIt from, RandomIt to, Compare &cmp) {
+                      std::sort(from, to, cmp);
+                    });
+}
+
+template <typename RandomIt, typename Compare>
+void StableSort(ThreadPool &pool, RandomIt first, RandomIt last,
+                Compare comp) {
+  detail::MergeSort(pool, first, last, comp,
+                    [](RandomIt from, RandomIt to, Compare &cmp) {
+                      std::stable_sort(from, to, cmp);
+                    });
+}
+
+template <typename RandomIt, typename OutputIt, typename UnaryOp>
+OutputIt Transform(ThreadPool &pool, RandomIt first, RandomIt last,
+                   OutputIt d_first, UnaryOp op) {
+  size_t size = static_cast<size_t>(last - first);
+  size_t chunks = detail::ChunkCount(size);
+  pool.ParallelFor(chunks, [&](size_t i) {
+    size_t begin = detail::ChunkBegin(size, chunks, i);
+    size_t end = detail::ChunkBegin(size, chunks, i + 1);
+    std::transform(first + begin, first + end, d_first + begin, op);
+  });
+  return d_first + size;
+}
+
+template <typename RandomIt, typename Function>
+void ForEach(ThreadPool &pool, RandomIt first, RandomIt last, Function fn) {
+  size_t size = static_cast<size_t>(last - first);
+  size_t chunks = detail::ChunkCount(size);
+  pool.ParallelFor(chunks, [&](size_t i) {
+    std::for_each(first + detail::ChunkBegin(size, chunks, i),
+                  first + detail::ChunkBegin(size, chunks, i + 1), fn);
+  });
+}
+
+template <typename RandomIt, typename T, typename BinaryOp>
+T Reduce(ThreadPool &pool, RandomIt first, RandomIt last, T init,
+         BinaryOp op) {
+  size_t size = static_cast<size_t>(last - first);
+  if (size == 0) return init;
+  size_t chunks = detail::ChunkCount(size);
+  // Каждая часть сворачивается от своего первого элемента, нейтральный
+  // элемент для op не нужен
+  std::vector<T> partial(chunks, init);
+  pool.ParallelFor(chunks, [&](size_t i) {
+    RandomIt it = first + detail::ChunkBegin(size, chunks, i);
+    RandomIt end = first + detail::ChunkBegin(size, chunks, i + 1);
+    T acc(*it);
+    for (++it; it != end; ++it) {
+      acc = op(std::move(acc), *it);
+    }
+    partial[i] = std::move(acc);
+  });
+  for (T &value : partial) {
+    init = op(std::move(init), std::move(value));
+  }
+  return init;
+}
+
+}  // namespace parallel
+}  // namespace s21
+
+#endif  // SRC_PARALLEL_S21_PARALLEL_TPP_
@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 
 namespace s21 {
 template <typename T>
@@ -96,8 +97,13 @@ class Queue {
   bool Empty() const { return size_ == 0; }
   size_type Size() const { return size_; }
 
-  void Push(const_reference value) {
-    Node* newNode = new Node(value);
+  void Push(const_reference value) { Emplace(value); }
+
+  void Push(value_type&& value) { Emplace(std::move(value)); }
+
+  template <typename... Args>
+  reference Emplace(Args&&... args) {
+    Node* newNode = new Node(std::in_place, std::forward<Args>(args)...);
     if (tail_ == nullptr) {
       head_ = tail_ = newNode;
     } else {
@@ -106,6 +112,7 @@ class Queue {
       tail_ = newNode;
     }
     ++size_;
+    return newNode->data;
   }
 
   void Pop() {
@@ -146,6 +153,9 @@ class Queue {
         : data(value),
           next(nullptr),
           previous(nullptr) {}  // конструктор класса Node
+    template <typename... Args>
+    Node(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), next(nullptr), previous(nullptr) {}
   };
 
   Node* head_;      // первый
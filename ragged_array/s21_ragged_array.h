@@ -0,0 +1,128 @@
+#ifndef SRC_RAGGED_ARRAY_S21_RAGGED_ARRAY_H_
+#define SRC_RAGGED_ARRAY_S21_RAGGED_ARRAY_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * Массив строк разной длины в формате CSR: все значения лежат подряд в
+ * одном Vector, а offsets_[r] и offsets_[r + 1] ограничивают строку r.
+ * В отличие от Vector<Vector<T>> здесь два блока памяти на весь массив, а
+ * не по одному на строку, обход всех значений — один линейный проход, а
+ * копия массива — копия двух буферов.
+ *
+ * Строки добавляются только в конец: AppendRow целиком или AddRow и затем
+ * PushBack в последнюю строку. Freeze() завершает построение: обрезает
+ * лишнюю ёмкость, после чего добавление бросает std::logic_error.
+ * Значения при этом остаются изменяемыми.
+ */
+template <typename T>
+class RaggedArray {
+ public:
+  using valueType = T;
+  using reference = T &;
+  using constReference = const T &;
+  using iterator = T *;
+  using constIterator = const T *;
+  using sizeType = size_t;
+
+  // Строка как пара указателей в общий буфер
+  template <bool kConst>
+  class RowSpan {
+    using Value = std::conditional_t<kConst, const T, T>;
+
+   public:
+    RowSpan(Value *data, sizeType size) : data_(data), size_(size) {}
+    template <bool kFromMutable = !kConst,
+              typename = std::enable_if_t<kFromMutable>>
+    operator RowSpan<true>() const {
+      return {data_, size_};
+    }
+
+    Value *Data() const { return data_; }
+    Value *Begin() const { return data_; }
+    Value *End() const { return data_ + size_; }
+    sizeType Size() const { return size_; }
+    bool Empty() const { return size_ == 0; }
+    Value &operator[](sizeType pos) const { return data_[pos]; }
+    Value &At(sizeType pos) const {
+      if (pos >= size_) throw std::out_of_range("Index out of range");
+      return data_[pos];
+    }
+
+   private:
+    Value *data_;
+    sizeType size_;
+  };
+
+  using rowSpan = RowSpan<false>;
+  using constRowSpan = RowSpan<true>;
+
+  RaggedArray() = default;
+  // Копирует строки вложенного вектора
+  explicit RaggedArray(const Vector<Vector<valueType>> &rows);
+  RaggedArray(std::initializer_list<std::initializer_list<valueType>> rows);
+
+  void Swap(RaggedArray &other);
+
+  rowSpan operator[](sizeType r);
+  constRowSpan operator[](sizeType r) const;
+  // Бросает out_of_range для несуществующей строки
+  rowSpan Row(sizeType r);
+  constRowSpan Row(sizeType r) const;
+  sizeType RowSize(sizeType r) const;
+
+  // Все значения подряд, строка за строкой
+  iterator Begin();
+  iterator End();
+  constIterator Begin() const;
+  constIterator End() const;
+  // Rows() + 1 смещений, первое равно нулю; без строк смещений нет
+  const sizeType *Offsets() const;
+
+  bool Empty() const;
+  sizeType Rows() const;
+  // Общее число значений
+  sizeType Size() const;
+  void Reserve(sizeType rows, sizeType values);
+  // Удаляет все строки и снова разрешает добавление
+  void Clear();
+
+  // Добавляет пустую строку, в которую пишет PushBack
+  void AddRow();
+  template <typename InputIt>
+  void AppendRow(InputIt first, InputIt last);
+  void AppendRow(std::initializer_list<valueType> values);
+  // Добавляет значение в последнюю строку
+  void PushBack(constReference value);
+  void PushBack(valueType &&value);
+  template <typename... Args>
+  reference EmplaceBack(Args &&...args);
+
+  void Freeze();
+  bool IsFrozen() const;
+
+ private:
+  void CheckRow(sizeType r) const;
+  void CheckMutable() const;
+  void CheckHasRow() const;
+  // Первое смещение появляется вместе с первой строкой
+  void StartOffsets();
+
+  Vector<valueType> values_;
+  Vector<sizeType> offsets_;
+  bool frozen_ = false;
+};
+
+}  // namespace s21
+
+#include "s21_ragged_array.tpp"
+
+#endif  // SRC_RAGGED_ARRAY_S21_RAGGED_ARRAY_H_
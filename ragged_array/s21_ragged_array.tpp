@@ -0,0 +1,201 @@
+#ifndef SRC_RAGGED_ARRAY_S21_RAGGED_ARRAY_TPP_
+#define SRC_RAGGED_ARRAY_S21_RAGGED_ARRAY_TPP_
+
+namespace s21 {
+
+template <typename T>
+RaggedArray<T>::RaggedArray(const Vector<Vector<valueType>> &rows) {
+  const Vector<valueType> *data = rows.Data();
+  sizeType total = 0;
+  for (sizeType r = 0; r < rows.Size(); ++r) total += data[r].Size();
+  Reserve(rows.Size(), total);
+  for (sizeType r = 0; r < rows.Size(); ++r) {
+    AppendRow(data[r].Begin(), data[r].End());
+  }
+}
+
+template <typename T>
+RaggedArray<T>::RaggedArray(
+    std::initializer_list<std::initializer_list<valueType>> rows) {
+  sizeType total = 0;
+  for (const auto &values : rows) total += values.size();
+  Reserve(rows.size(), total);
+  for (const auto &values : rows) AppendRow(values);
+}
+
+template <typename T>
+void RaggedArray<T>::Swap(RaggedArray &other) {
+  values_.Swap(other.values_);
+  offsets_.Swap(other.offsets_);
+  std::swap(frozen_, other.frozen_);
+}
+
+template <typename T>
+typename RaggedArray<T>::rowSpan RaggedArray<T>::operator[](sizeType r) {
+  const sizeType *offsets = offsets_.Data();
+  return rowSpan(values_.Data() + offsets[r], offsets[r + 1] - offsets[r]);
+}
+
+template <typename T>
+typename RaggedArray<T>::constRowSpan RaggedArray<T>::operator[](
+    sizeType r) const {
+  const sizeType *offsets = offsets_.Data();
+  return constRowSpan(values_.Data() + offsets[r],
+                      offsets[r + 1] - offsets[r]);
+}
+
+template <typename T>
+typename RaggedArray<T>::rowSpan RaggedArray<T>::Row(sizeType r) {
+  CheckRow(r);
+  return (*this)[r];
+}
+
+template <typename T>
+typename RaggedArray<T>::constRowSpan RaggedArray<T>::Row(sizeType r) const {
+  CheckRow(r);
+  return (*this)[r];
+}
+
+template <typename T>
+typename RaggedArray<T>::sizeType RaggedArray<T>::RowSize(sizeType r) const {
+  CheckRow(r);
+  return offsets_.Data()[r + 1] - offsets_.Data()[r];
+}
+
+template <typename T>
+typename RaggedArray<T>::iterator RaggedArray<T>::Begin() {
+  return values_.Begin();
+}
+
+template <typename T>
+typename RaggedArray<T>::iterator RaggedArray<T>::End() {
+  return values_.End();
+}
+
+template <typename T>
+typename RaggedArray<T>::constIterator RaggedArray<T>::Begin() const {
+  return values_.Begin();
+}
+
+template <typename T>
+typename RaggedArray<T>::constIterator RaggedArray<T>::End() const {
+  return values_.End();
+}
+
+template <typename T>
+const typename RaggedArray<T>::sizeType *RaggedArray<T>::Offsets() const {
+  return offsets_.Data();
+}
+
+template <typename T>
+bool RaggedArray<T>::Empty() const {
+  return Rows() == 0;
+}
+
+template <typename T>
+typename RaggedArray<T>::sizeType RaggedArray<T>::Rows() const {
+  return offsets_.Empty() ? 0 : offsets_.Size() - 1;
+}
+
+template <typename T>
+typename RaggedArray<T>::sizeType RaggedArray<T>::Size() const {
+  return values_.Size();
+}
+
+template <typename T>
+void RaggedArray<T>::Reserve(sizeType rows, sizeType values) {
+  CheckMutable();
+  offsets_.Reserve(rows + 1);
+  values_.Reserve(values);
+}
+
+template <typename T>
+void RaggedArray<T>::Clear() {
+  values_.Clear();
+  offsets_.Clear();
+  frozen_ = false;
+}
+
+template <typename T>
+void RaggedArray<T>::AddRow() {
+  CheckMutable();
+  StartOffsets();
+  offsets_.PushBack(values_.Size());
+}
+
+template <typename T>
+template <typename InputIt>
+void RaggedArray<T>::AppendRow(InputIt first, InputIt last) {
+  CheckMutable();
+  StartOffsets();
+  sizeType old_size = values_.Size();
+  try {
+    values_.Insert(values_.End(), first, last);
+    offsets_.PushBack(values_.Size());
+  } catch (...) {
+    values_.Erase(values_.Begin() + old_size, values_.End());
+    throw;
+  }
+}
+
+template <typename T>
+void RaggedArray<T>::AppendRow(std::initializer_list<valueType> values) {
+  AppendRow(values.begin(), values.end());
+}
+
+template <typename T>
+void RaggedArray<T>::PushBack(constReference value) {
+  EmplaceBack(value);
+}
+
+template <typename T>
+void RaggedArray<T>::PushBack(valueType &&value) {
+  EmplaceBack(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename RaggedArray<T>::reference RaggedArray<T>::EmplaceBack(
+    Args &&...args) {
+  CheckMutable();
+  CheckHasRow();
+  reference value = values_.EmplaceBack(std::forward<Args>(args)...);
+  ++offsets_[offsets_.Size() - 1];
+  return value;
+}
+
+template <typename T>
+void RaggedArray<T>::Freeze() {
+  values_.ShrinkToFit();
+  offsets_.ShrinkToFit();
+  frozen_ = true;
+}
+
+template <typename T>
+bool RaggedArray<T>::IsFrozen() const {
+  return frozen_;
+}
+
+template <typename T>
+void RaggedArray<T>::CheckRow(sizeType r) const {
+  if (r >= Rows()) throw std::out_of_range("Row index out of range");
+}
+
+template <typename T>
+void RaggedArray<T>::CheckMutable() const {
+  if (frozen_) throw std::logic_error("RaggedArray is frozen");
+}
+
+template <typename T>
+void RaggedArray<T>::CheckHasRow() const {
+  if (Rows() == 0) throw std::logic_error("RaggedArray has no rows");
+}
+
+template <typename T>
+void RaggedArray<T>::StartOffsets() {
+  if (offsets_.Empty()) offsets_.PushBack(0);
+}
+
+}  // namespace s21
+
+#endif  // SRC_RAGGED_ARRAY_S21_RAGGED_ARRAY_TPP_
@@ -1,7 +1,17 @@
 #ifndef SRC_S21_CONTAINERS_PLUS_H_
 #define SRC_S21_CONTAINERS_PLUS_H_
 
-#include "multi_set/s21_multiset.h"
 #include "array/s21_array.h"
+#include "bit_vector/s21_bit_vector.h"
+#include "compact_set/s21_compact_set.h"
+#include "concurrent_vector/s21_concurrent_vector.h"
+#include "deque/s21_deque.h"
+#include "mapped_vector/s21_mapped_vector.h"
+#include "multi_set/s21_multiset.h"
+#include "ragged_array/s21_ragged_array.h"
+#include "slot_map/s21_slot_map.h"
+#include "small_vector/s21_small_vector.h"
+#include "soa_vector/s21_soa_vector.h"
+#include "tombstone_vector/s21_tombstone_vector.h"
 
 #endif  // SRC_S21_CONTAINERS_PLUS_H_
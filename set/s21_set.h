@@ -69,6 +69,32 @@ class Set : public BinaryTreeBase<Key, Key> {
   bool Empty() const { return BinaryTreeBase<Key, Key>::Empty(); }
   size_t Size() const { return BinaryTreeBase<Key, Key>::Size(); }
   void Clear() { BinaryTreeBase<Key, Key>::Clear(); }
+
+  // Делит множество на ключи меньше key и остальные, множество становится
+  // пустым
+  std::pair<Set, Set> Split(const Key &key) {
+    std::pair<Set, Set> parts;
+    this->SplitInto(key, parts.first, parts.second);
+    return parts;
+  }
+
+  // Склеивает множества, все ключи left должны быть меньше ключей right
+  static Set Join(Set &&left, Set &&right) {
+    Set result;
+    result.JoinFrom(left, right, true);
+    return result;
+  }
+
+  // Параллельный обход: fn(const Key &) для каждого элемента
+  template <typename Function>
+  void ParallelForEach(Function fn,
+                       size_t threads = std::thread::hardware_concurrency()) {
+    this->ParallelForEachNode(
+        [&fn](typename BinaryTreeBase<Key, Key>::Node *node) {
+          fn(static_cast<const Key &>(node->key));
+        },
+        threads);
+  }
 };
 }  // namespace s21
 #endif  // SRC_SET_S21_SET_H_
@@ -0,0 +1,100 @@
+#ifndef SRC_SIMD_S21_SIMD_H_
+#define SRC_SIMD_S21_SIMD_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+/*
+ * Векторизованные алгоритмы для непрерывных диапазонов арифметических
+ * типов. Для int32_t, float и double используются ядра SSE2/AVX2, набор
+ * инструкций выбирается при первом вызове по CPUID; для остальных типов и
+ * других архитектур работает скалярная версия. Ядра написаны на векторных
+ * расширениях GCC/Clang, поэтому один шаблон собирается под обе ширины.
+ *
+ * Min/Max для float/double не определены, если в диапазоне есть NaN.
+ * Sum для float/double складывает по дорожкам, поэтому результат может
+ * отличаться от последовательной суммы в младших битах.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define S21_SIMD_X86 1
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+namespace simd {
+
+enum class Isa { kScalar, kSse2, kAvx2 };
+
+// Лучший набор инструкций, доступный на этом процессоре
+inline Isa DetectedIsa();
+
+// Типы, для которых есть векторные ядра
+template <typename T>
+inline constexpr bool kHasKernels =
+    std::is_same_v<T, int32_t> || std::is_same_v<T, float> ||
+    std::is_same_v<T, double>;
+
+// Целые суммируются в 64-битном типе, чтобы сумма int32_t не переполнялась
+template <typename T>
+using SumType = std::conditional_t<
+    std::is_integral_v<T>,
+    std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>, T>;
+
+// Не даёт выводить T из значения, чтобы Fill(p, q, 0) работал для double
+template <typename T>
+struct NonDeduced {
+  using type = T;
+};
+
+template <typename T>
+const T* Find(const T* first, const T* last,
+             typename NonDeduced<T>::type value);
+template <typename T>
+size_t Count(const T* first, const T* last,
+             typename NonDeduced<T>::type value);
+template <typename T>
+T Min(const T* first, const T* last);
+template <typename T>
+T Max(const T* first, const T* last);
+template <typename T>
+SumType<T> Sum(const T* first, const T* last);
+template <typename T>
+void Fill(T* first, T* last, typename NonDeduced<T>::type value);
+template <typename T>
+bool Equal(const T* first, const T* last, const T* other);
+
+// Перегрузки для Vector и Array
+template <typename Container>
+auto Find(Container& container, typename Container::valueType value)
+    -> decltype(container.Begin());
+template <typename Container>
+size_t Count(const Container& container, typename Container::valueType value);
+template <typename Container>
+typename Container::valueType Min(const Container& container);
+template <typename Container>
+typename Container::valueType Max(const Container& container);
+template <typename Container>
+SumType<typename Container::valueType> Sum(const Container& container);
+template <typename Container>
+void Fill(Container& container, typename Container::valueType value);
+template <typename Container>
+bool Equal(const Container& left, const Container& right);
+
+/*
+ * Реализации для конкретного набора инструкций (scalar, sse2, avx2) открыты
+ * для тестов и объявлены только в s21_simd.tpp: атрибут target должен быть
+ * на первом объявлении функции.
+ */
+
+}  // namespace simd
+}  // namespace s21
+
+#include "s21_simd.tpp"
+
+#endif  // SRC_SIMD_S21_SIMD_H_
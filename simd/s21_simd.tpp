@@ -0,0 +1,470 @@
+#ifndef SRC_SIMD_S21_SIMD_TPP_
+#define SRC_SIMD_S21_SIMD_TPP_
+
+namespace s21 {
+namespace simd {
+
+inline Isa DetectedIsa() {
+#if S21_SIMD_X86
+  static const Isa isa = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return Isa::kAvx2;
+    if (__builtin_cpu_supports("sse2")) return Isa::kSse2;
+    return Isa::kScalar;
+  }();
+  return isa;
+#else
+  return Isa::kScalar;
+#endif
+}
+
+namespace detail {
+
+template <typename T>
+void CheckNotEmpty(const T* first, const T* last) {
+  if (first == last) {
+    throw std::out_of_range("Range is empty");
+  }
+}
+
+template <typename T>
+Isa ActiveIsa() {
+  if constexpr (kHasKernels<T>) {
+    return DetectedIsa();
+  } else {
+    return Isa::kScalar;
+  }
+}
+
+#if S21_SIMD_X86
+
+/*
+ * Ядра общие для SSE2 и AVX2: Bytes задаёт ширину регистра. Они всегда
+ * встраиваются в обёртки ниже, и компилятор генерирует код под target
+ * обёртки. Загрузки и сохранения идут через memcpy, поэтому выравнивание
+ * данных не требуется.
+ */
+template <typename T, size_t Bytes>
+struct Lanes {
+  typedef T Reg __attribute__((vector_size(Bytes)));
+  static constexpr size_t kCount = Bytes / sizeof(T);
+  // Для суммы: kWideCount элементов расширяются до регистра SumType<T>
+  using Wide = SumType<T>;
+  static constexpr size_t kWideCount = Bytes / sizeof(Wide);
+  typedef Wide WideReg __attribute__((vector_size(Bytes)));
+  typedef T NarrowReg __attribute__((vector_size(kWideCount * sizeof(T))));
+};
+
+// Регистры передаются по ссылке: передача по значению меняет ABI под AVX
+template <typename Reg>
+[[gnu::always_inline]] inline void Load(Reg& reg, const void* src) {
+  std::memcpy(&reg, src, sizeof(reg));
+}
+
+// Есть ли хотя бы одна ненулевая дорожка в маске сравнения
+template <typename Mask>
+[[gnu::always_inline]] inline bool AnyLane(const Mask& mask) {
+  uint64_t words[sizeof(Mask) / sizeof(uint64_t)];
+  std::memcpy(words, &mask, sizeof(mask));
+  uint64_t any = 0;
+  for (uint64_t word : words) {
+    any |= word;
+  }
+  return any != 0;
+}
+
+template <typename T, size_t Bytes>
+[[gnu::always_inline]] inline const T* FindKernel(const T* first,
+                                                  const T* last, T value) {
+  using L = Lanes<T, Bytes>;
+  typename L::Reg key = typename L::Reg{} + value;
+  typename L::Reg block;
+  for (; static_cast<size_t>(last - first) >= L::kCount; first += L::kCount) {
+    Load(block, first);
+    if (AnyLane(block == key)) break;
+  }
+  while (first != last && !(*first == value)) ++first;
+  return first;
+}
+
+template <typename T, size_t Bytes>
+[[gnu::always_inline]] inline size_t CountKernel(const T* first,
+                                                 const T* last, T value) {
+  using L = Lanes<T, Bytes>;
+  using Mask = decltype(typename L::Reg{} == typename L::Reg{});
+  // Счётчики в дорожках сбрасываются в total до переполнения
+  constexpr size_t kFlushBlocks = size_t{1} << 30;
+  typename L::Reg key = typename L::Reg{} + value;
+  typename L::Reg block;
+  size_t total = 0;
+  while (static_cast<size_t>(last - first) >= L::kCount) {
+    Mask counts{};
+    size_t blocks = std::min<size_t>((last - first) / L::kCount, kFlushBlocks);
+    for (size_t i = 0; i < blocks; ++i, first += L::kCount) {
+      // Совпавшая дорожка равна -1
+      Load(block, first);
+      counts -= block == key;
+    }
+    for (size_t i = 0; i < L::kCount; ++i) {
+      total += static_cast<size_t>(counts[i]);
+    }
+  }
+  for (; first != last; ++first) {
+    total += *first == value;
+  }
+  return total;
+}
+
+template <typename T, size_t Bytes, bool kMin>
+[[gnu::always_inline]] inline T MinMaxKernel(const T* first, const T* last) {
+  using L = Lanes<T, Bytes>;
+  T best = *first;
+  if (static_cast<size_t>(last - first) >= L::kCount) {
+    typename L::Reg acc, block;
+    Load(acc, first);
+    for (first += L::kCount; static_cast<size_t>(last - first) >= L::kCount;
+         first += L::kCount) {
+      Load(block, first);
+      if constexpr (kMin) {
+        acc = block < acc ? block : acc;
+      } else {
+        acc = acc < block ? block : acc;
+      }
+    }
+    best = acc[0];
+    for (size_t i = 1; i < L::kCount; ++i) {
+      best = kMin ? (acc[i] < best ? acc[i] : best)
+                  : (best < acc[i] ? acc[i] : best);
+    }
+  }
+  for (; first != last; ++first) {
+    best = kMin ? (*first < best ? *first : best)
+                : (best < *first ? *first : best);
+  }
+  return best;
+}
+
+template <typename T, size_t Bytes>
+[[gnu::always_inline]] inline SumType<T> SumKernel(const T* first,
+                                                   const T* last) {
+  using L = Lanes<T, Bytes>;
+  typename L::WideReg acc{};
+  typename L::NarrowReg block;
+  for (; static_cast<size_t>(last - first) >= L::kWideCount;
+       first += L::kWideCount) {
+    Load(block, first);
+    acc += __builtin_convertvector(block, typename L::WideReg);
+  }
+  SumType<T> sum{};
+  for (size_t i = 0; i < L::kWideCount; ++i) {
+    sum += acc[i];
+  }
+  for (; first != last; ++first) {
+    sum += *first;
+  }
+  return sum;
+}
+
+template <typename T, size_t Bytes>
+[[gnu::always_inline]] inline void FillKernel(T* first, T* last, T value) {
+  using L = Lanes<T, Bytes>;
+  typename L::Reg block = typename L::Reg{} + value;
+  for (; static_cast<size_t>(last - first) >= L::kCount; first += L::kCount) {
+    std::memcpy(first, &block, sizeof(block));
+  }
+  for (; first != last; ++first) {
+    *first = value;
+  }
+}
+
+template <typename T, size_t Bytes>
+[[gnu::always_inline]] inline bool EqualKernel(const T* first, const T* last,
+                                               const T* other) {
+  using L = Lanes<T, Bytes>;
+  typename L::Reg left, right;
+  for (; static_cast<size_t>(last - first) >= L::kCount;
+       first += L::kCount, other += L::kCount) {
+    Load(left, first);
+    Load(right, other);
+    if (AnyLane(left != right)) return false;
+  }
+  for (; first != last; ++first, ++other) {
+    if (!(*first == *other)) return false;
+  }
+  return true;
+}
+
+#endif  // S21_SIMD_X86
+
+}  // namespace detail
+
+// Скалярные версии
+
+namespace scalar {
+
+template <typename T>
+const T* Find(const T* first, const T* last, T value) {
+  while (first != last && !(*first == value)) ++first;
+  return first;
+}
+
+template <typename T>
+size_t Count(const T* first, const T* last, T value) {
+  size_t total = 0;
+  for (; first != last; ++first) {
+    total += *first == value;
+  }
+  return total;
+}
+
+template <typename T>
+T Min(const T* first, const T* last) {
+  detail::CheckNotEmpty(first, last);
+  T best = *first;
+  for (++first; first != last; ++first) {
+    if (*first < best) best = *first;
+  }
+  return best;
+}
+
+template <typename T>
+T Max(const T* first, const T* last) {
+  detail::CheckNotEmpty(first, last);
+  T best = *first;
+  for (++first; first != last; ++first) {
+    if (best < *first) best = *first;
+  }
+  return best;
+}
+
+template <typename T>
+SumType<T> Sum(const T* first, const T* last) {
+  SumType<T> sum{};
+  for (; first != last; ++first) {
+    sum += *first;
+  }
+  return sum;
+}
+
+template <typename T>
+void Fill(T* first, T* last, T value) {
+  for (; first != last; ++first) {
+    *first = value;
+  }
+}
+
+template <typename T>
+bool Equal(const T* first, const T* last, const T* other) {
+  for (; first != last; ++first, ++other) {
+    if (!(*first == *other)) return false;
+  }
+  return true;
+}
+
+}  // namespace scalar
+
+#if S21_SIMD_X86
+
+// SSE2: 16-байтные регистры
+
+namespace sse2 {
+
+template <typename T>
+__attribute__((target("sse2"))) const T* Find(const T* first, const T* last,
+                                               T value) {
+  return detail::FindKernel<T, 16>(first, last, value);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) size_t Count(const T* first, const T* last,
+                                             T value) {
+  return detail::CountKernel<T, 16>(first, last, value);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) T Min(const T* first, const T* last) {
+  detail::CheckNotEmpty(first, last);
+  return detail::MinMaxKernel<T, 16, true>(first, last);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) T Max(const T* first, const T* last) {
+  detail::CheckNotEmpty(first, last);
+  return detail::MinMaxKernel<T, 16, false>(first, last);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) SumType<T> Sum(const T* first,
+                                                const T* last) {
+  return detail::SumKernel<T, 16>(first, last);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) void Fill(T* first, T* last, T value) {
+  detail::FillKernel<T, 16>(first, last, value);
+}
+
+template <typename T>
+__attribute__((target("sse2"))) bool Equal(const T* first, const T* last,
+                                           const T* other) {
+  return detail::EqualKernel<T, 16>(first, last, other);
+}
+
+}  // namespace sse2
+
+// AVX2: 32-байтные регистры
+
+namespace avx2 {
+
+template <typename T>
+__attribute__((target("avx2"))) const T* Find(const T* first, const T* last,
+                                               T value) {
+  return detail::FindKernel<T, 32>(first, last, value);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) size_t Count(const T* first, const T* last,
+                                             T value) {
+  return detail::CountKernel<T, 32>(first, last, value);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) T Min(const T* first, const T* last) {
+  detail::CheckNotEmpty(first, last);
+  return detail::MinMaxKernel<T, 32, true>(first, last);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) T Max(const T* first, const T* last) {
+  detail::CheckNotEmpty(first, last);
+  return detail::MinMaxKernel<T, 32, false>(first, last);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) SumType<T> Sum(const T* first,
+                                                const T* last) {
+  return detail::SumKernel<T, 32>(first, last);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void Fill(T* first, T* last, T value) {
+  detail::FillKernel<T, 32>(first, last, value);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) bool Equal(const T* first, const T* last,
+                                           const T* other) {
+  return detail::EqualKernel<T, 32>(first, last, other);
+}
+
+}  // namespace avx2
+
+#endif  // S21_SIMD_X86
+
+// Диспетчеризация по набору инструкций
+
+#if S21_SIMD_X86
+#define S21_SIMD_DISPATCH(T, Name, ...)                 \
+  switch (detail::ActiveIsa<T>()) {                     \
+    case Isa::kAvx2:                                    \
+      if constexpr (kHasKernels<T>) {                   \
+        return avx2::Name<T>(__VA_ARGS__);              \
+      }                                                 \
+      [[fallthrough]];                                  \
+    case Isa::kSse2:                                    \
+      if constexpr (kHasKernels<T>) {                   \
+        return sse2::Name<T>(__VA_ARGS__);              \
+      }                                                 \
+      [[fallthrough]];                                  \
+    default:                                            \
+      return scalar::Name<T>(__VA_ARGS__);              \
+  }
+#else
+#define S21_SIMD_DISPATCH(T, Name, ...) return scalar::Name<T>(__VA_ARGS__);
+#endif
+
+template <typename T>
+const T* Find(const T* first, const T* last,
+              typename NonDeduced<T>::type value) {
+  S21_SIMD_DISPATCH(T, Find, first, last, value)
+}
+
+template <typename T>
+size_t Count(const T* first, const T* last,
+             typename NonDeduced<T>::type value) {
+  S21_SIMD_DISPATCH(T, Count, first, last, value)
+}
+
+template <typename T>
+T Min(const T* first, const T* last) {
+  S21_SIMD_DISPATCH(T, Min, first, last)
+}
+
+template <typename T>
+T Max(const T* first, const T* last) {
+  S21_SIMD_DISPATCH(T, Max, first, last)
+}
+
+template <typename T>
+SumType<T> Sum(const T* first, const T* last) {
+  S21_SIMD_DISPATCH(T, Sum, first, last)
+}
+
+template <typename T>
+void Fill(T* first, T* last, typename NonDeduced<T>::type value) {
+  S21_SIMD_DISPATCH(T, Fill, first, last, value)
+}
+
+template <typename T>
+bool Equal(const T* first, const T* last, const T* other) {
+  S21_SIMD_DISPATCH(T, Equal, first, last, other)
+}
+
+#undef S21_SIMD_DISPATCH
+
+// Перегрузки для контейнеров
+
+template <typename Container>
+auto Find(Container& container, typename Container::valueType value)
+    -> decltype(container.Begin()) {
+  return container.Begin() +
+         (Find(container.Data(), container.Data() + container.Size(), value) -
+          container.Data());
+}
+
+template <typename Container>
+size_t Count(const Container& container,
+             typename Container::valueType value) {
+  return Count(container.Data(), container.Data() + container.Size(), value);
+}
+
+template <typename Container>
+typename Container::valueType Min(const Container& container) {
+  return Min(container.Data(), container.Data() + container.Size());
+}
+
+template <typename Container>
+typename Container::valueType Max(const Container& container) {
+  return Max(container.Data(), container.Data() + container.Size());
+}
+
+template <typename Container>
+SumType<typename Container::valueType> Sum(const Container& container) {
+  return Sum(container.Data(), container.Data() + container.Size());
+}
+
+template <typename Container>
+void Fill(Container& container, typename Container::valueType value) {
+  Fill(container.Data(), container.Data() + container.Size(), value);
+}
+
+template <typename Container>
+bool Equal(const Container& left, const Container& right) {
+  return left.Size() == right.Size() &&
+         Equal(left.Data(), left.Data() + left.Size(), right.Data());
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // SRC_SIMD_S21_SIMD_TPP_
@@ -0,0 +1,112 @@
+#ifndef SRC_SLOT_MAP_S21_SLOT_MAP_H_
+#define SRC_SLOT_MAP_S21_SLOT_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * Контейнер со стабильными дескрипторами. Значения лежат подряд в Vector,
+ * поэтому обход идёт со скоростью массива. Дескриптор (Handle) — номер
+ * ячейки в таблице косвенности и её поколение; ячейка хранит позицию
+ * значения в плотном массиве. Вставка, удаление и поиск — O(1): при
+ * удалении на место значения переносится последнее, и исправляется одна
+ * ячейка.
+ *
+ * Поколение ячейки нечётно, пока она занята, и увеличивается при каждой
+ * вставке и удалении, поэтому дескриптор удалённого значения никогда не
+ * совпадёт с новым в той же ячейке. Ячейка, поколение которой исчерпано,
+ * больше не используется. Порядок значений в плотном массиве меняется при
+ * удалении.
+ */
+template <typename T>
+class SlotMap {
+ public:
+  using valueType = T;
+  using reference = T &;
+  using constReference = const T &;
+  using iterator = T *;
+  using constIterator = const T *;
+  using sizeType = size_t;
+
+  struct Handle {
+    static constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index = kNone;
+    uint32_t generation = 0;
+
+    bool operator==(const Handle &other) const {
+      return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const Handle &other) const { return !(*this == other); }
+  };
+
+  SlotMap() = default;
+
+  void Swap(SlotMap &other);
+
+  Handle Insert(constReference value);
+  Handle Insert(valueType &&value);
+  template <typename... Args>
+  Handle Emplace(Args &&...args);
+  // false, если дескриптор устарел
+  bool Erase(Handle handle);
+
+  bool Contains(Handle handle) const;
+  // nullptr, если дескриптор устарел
+  T *Find(Handle handle);
+  const T *Find(Handle handle) const;
+  // Бросает out_of_range для устаревшего дескриптора
+  reference At(Handle handle);
+  constReference At(Handle handle) const;
+  // Без проверки
+  reference operator[](Handle handle);
+  constReference operator[](Handle handle) const;
+
+  // Плотный массив значений; порядок меняется при удалении
+  iterator Data();
+  iterator Begin();
+  iterator End();
+  constIterator Data() const;
+  constIterator Begin() const;
+  constIterator End() const;
+  // Дескриптор значения в позиции pos плотного массива
+  Handle HandleAt(sizeType pos) const;
+
+  bool Empty() const;
+  sizeType Size() const;
+  sizeType MaxSize() const;
+  void Reserve(sizeType size);
+  // Удаляет все значения; все выданные дескрипторы устаревают
+  void Clear();
+
+ private:
+  struct Slot {
+    // Позиция значения в values_ или следующая свободная ячейка
+    uint32_t index;
+    uint32_t generation;
+  };
+
+  // Делает ячейку свободной и устаревшими её дескрипторы
+  void Release(uint32_t slot);
+  uint32_t CheckedSlot(Handle handle) const;
+
+  Vector<valueType> values_;
+  // Ячейка, которой принадлежит каждое значение
+  Vector<uint32_t> owners_;
+  Vector<Slot> slots_;
+  uint32_t free_head_ = Handle::kNone;
+};
+
+}  // namespace s21
+
+#include "s21_slot_map.tpp"
+
+#endif  // SRC_SLOT_MAP_S21_SLOT_MAP_H_
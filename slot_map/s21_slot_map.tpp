@@ -0,0 +1,191 @@
+#ifndef SRC_SLOT_MAP_S21_SLOT_MAP_TPP_
+#define SRC_SLOT_MAP_S21_SLOT_MAP_TPP_
+
+namespace s21 {
+
+template <typename T>
+void SlotMap<T>::Swap(SlotMap &other) {
+  values_.Swap(other.values_);
+  owners_.Swap(other.owners_);
+  slots_.Swap(other.slots_);
+  std::swap(free_head_, other.free_head_);
+}
+
+template <typename T>
+typename SlotMap<T>::Handle SlotMap<T>::Insert(constReference value) {
+  return Emplace(value);
+}
+
+template <typename T>
+typename SlotMap<T>::Handle SlotMap<T>::Insert(valueType &&value) {
+  return Emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename SlotMap<T>::Handle SlotMap<T>::Emplace(Args &&...args) {
+  // Всё, что может бросить, делается до изменения ячеек
+  if (free_head_ == Handle::kNone) {
+    if (slots_.Size() >= Handle::kNone) {
+      throw std::length_error("Requested Size exceeds the maximum Size.");
+    }
+    slots_.PushBack(Slot{Handle::kNone, 0});
+    free_head_ = static_cast<uint32_t>(slots_.Size() - 1);
+  }
+  values_.EmplaceBack(std::forward<Args>(args)...);
+  try {
+    owners_.PushBack(free_head_);
+  } catch (...) {
+    values_.PopBack();
+    throw;
+  }
+  uint32_t slot = free_head_;
+  Slot &cell = slots_[slot];
+  free_head_ = cell.index;
+  cell.index = static_cast<uint32_t>(values_.Size() - 1);
+  ++cell.generation;
+  return Handle{slot, cell.generation};
+}
+
+template <typename T>
+bool SlotMap<T>::Erase(Handle handle) {
+  if (!Contains(handle)) return false;
+  uint32_t pos = slots_[handle.index].index;
+  uint32_t last = static_cast<uint32_t>(values_.Size() - 1);
+  if (pos != last) {
+    values_[pos] = std::move(values_[last]);
+    owners_[pos] = owners_[last];
+    slots_[owners_[pos]].index = pos;
+  }
+  values_.PopBack();
+  owners_.PopBack();
+  Release(handle.index);
+  return true;
+}
+
+template <typename T>
+bool SlotMap<T>::Contains(Handle handle) const {
+  if (handle.index >= slots_.Size()) return false;
+  uint32_t generation = slots_.Data()[handle.index].generation;
+  return generation == handle.generation && generation % 2 == 1;
+}
+
+template <typename T>
+T *SlotMap<T>::Find(Handle handle) {
+  if (!Contains(handle)) return nullptr;
+  return values_.Data() + slots_[handle.index].index;
+}
+
+template <typename T>
+const T *SlotMap<T>::Find(Handle handle) const {
+  if (!Contains(handle)) return nullptr;
+  return values_.Data() + slots_.Data()[handle.index].index;
+}
+
+template <typename T>
+typename SlotMap<T>::reference SlotMap<T>::At(Handle handle) {
+  return values_[CheckedSlot(handle)];
+}
+
+template <typename T>
+typename SlotMap<T>::constReference SlotMap<T>::At(Handle handle) const {
+  return values_.Data()[CheckedSlot(handle)];
+}
+
+template <typename T>
+typename SlotMap<T>::reference SlotMap<T>::operator[](Handle handle) {
+  return values_[slots_[handle.index].index];
+}
+
+template <typename T>
+typename SlotMap<T>::constReference SlotMap<T>::operator[](
+    Handle handle) const {
+  return values_.Data()[slots_.Data()[handle.index].index];
+}
+
+template <typename T>
+typename SlotMap<T>::iterator SlotMap<T>::Data() {
+  return values_.Data();
+}
+
+template <typename T>
+typename SlotMap<T>::iterator SlotMap<T>::Begin() {
+  return values_.Begin();
+}
+
+template <typename T>
+typename SlotMap<T>::iterator SlotMap<T>::End() {
+  return values_.End();
+}
+
+template <typename T>
+typename SlotMap<T>::constIterator SlotMap<T>::Data() const {
+  return values_.Data();
+}
+
+template <typename T>
+typename SlotMap<T>::constIterator SlotMap<T>::Begin() const {
+  return values_.Begin();
+}
+
+template <typename T>
+typename SlotMap<T>::constIterator SlotMap<T>::End() const {
+  return values_.End();
+}
+
+template <typename T>
+typename SlotMap<T>::Handle SlotMap<T>::HandleAt(sizeType pos) const {
+  if (pos >= values_.Size()) throw std::out_of_range("Index out of range");
+  uint32_t slot = owners_.Data()[pos];
+  return Handle{slot, slots_.Data()[slot].generation};
+}
+
+template <typename T>
+bool SlotMap<T>::Empty() const {
+  return values_.Empty();
+}
+
+template <typename T>
+typename SlotMap<T>::sizeType SlotMap<T>::Size() const {
+  return values_.Size();
+}
+
+template <typename T>
+typename SlotMap<T>::sizeType SlotMap<T>::MaxSize() const {
+  return std::min<sizeType>(values_.MaxSize(), Handle::kNone);
+}
+
+template <typename T>
+void SlotMap<T>::Reserve(sizeType size) {
+  values_.Reserve(size);
+  owners_.Reserve(size);
+  slots_.Reserve(size);
+}
+
+template <typename T>
+void SlotMap<T>::Clear() {
+  for (sizeType pos = 0; pos < owners_.Size(); ++pos) {
+    Release(owners_[pos]);
+  }
+  values_.Clear();
+  owners_.Clear();
+}
+
+template <typename T>
+void SlotMap<T>::Release(uint32_t slot) {
+  Slot &cell = slots_[slot];
+  // Поколение 0 после переполнения: ячейку больше не выдаём
+  if (++cell.generation == 0) return;
+  cell.index = free_head_;
+  free_head_ = slot;
+}
+
+template <typename T>
+uint32_t SlotMap<T>::CheckedSlot(Handle handle) const {
+  if (!Contains(handle)) throw std::out_of_range("Handle is stale");
+  return slots_.Data()[handle.index].index;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SLOT_MAP_S21_SLOT_MAP_TPP_
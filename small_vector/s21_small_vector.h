@@ -0,0 +1,124 @@
+#ifndef SRC_SMALL_VECTOR_S21_SMALL_VECTOR_H_
+#define SRC_SMALL_VECTOR_S21_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/s21_allocator.h"
+#include "../memory/s21_buffer_ops.h"
+
+namespace s21 {
+
+/*
+ * Вектор с буфером на N элементов внутри объекта. Пока элементов не больше
+ * N, куча не используется; при переполнении элементы переносятся в
+ * динамическую память и дальше всё работает как в Vector. Интерфейс
+ * совпадает с Vector.
+ */
+template <typename T, size_t N = 16>
+class SmallVector {
+  static_assert(N > 0, "SmallVector needs a non-empty inline buffer");
+
+ public:
+  using valueType = T;
+  using reference = T &;
+  using constReference = const T &;
+  using iterator = T *;
+  using constIterator = const T *;
+  using sizeType = size_t;
+
+  SmallVector();
+  explicit SmallVector(sizeType n);
+  SmallVector(std::initializer_list<valueType> const &items);
+  SmallVector(const SmallVector &v);
+  SmallVector(SmallVector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~SmallVector();
+
+  SmallVector &operator=(const SmallVector &v);
+  SmallVector &operator=(SmallVector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+
+  void Swap(SmallVector &other);
+
+  reference At(sizeType pos);
+  reference operator[](sizeType pos);
+
+  constReference Front() const;
+  constReference Back() const;
+
+  iterator Data();
+  iterator Begin();
+  iterator End();
+
+  constIterator Data() const;
+  constIterator Begin() const;
+  constIterator End() const;
+
+  bool Empty() const;
+  sizeType Size() const;
+  sizeType MaxSize() const;
+  // Элементы лежат во встроенном буфере
+  bool IsInline() const;
+
+  void Reserve(sizeType size);
+  sizeType Capacity() const;
+  void ShrinkToFit();
+  void Clear();
+
+  iterator Insert(iterator pos, constReference value);
+  iterator Insert(iterator pos, valueType &&value);
+  template <typename InputIt>
+  iterator Insert(iterator pos, InputIt first, InputIt last);
+  iterator Erase(iterator pos);
+  iterator Erase(iterator first, iterator last);
+
+  template <typename Predicate>
+  iterator RemoveIf(Predicate pred);
+  template <typename Predicate>
+  sizeType EraseIf(Predicate pred);
+
+  void PushBack(constReference value);
+  void PushBack(valueType &&value);
+
+  template <typename... Args>
+  iterator Emplace(constIterator pos, Args &&...args);
+  template <typename... Args>
+  reference EmplaceBack(Args &&...args);
+
+  void PopBack();
+
+  template <typename... Args>
+  iterator InsertMany(constIterator pos, Args &&...args);
+
+  template <typename... Args>
+  void InsertManyBack(Args &&...args);
+
+ private:
+  size_t arr_size_;
+  size_t arr_capacity_;
+  iterator arr_;
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+  iterator InlineData();
+  sizeType GrowCapacity(sizeType required) const;
+  void ReallocMemory(sizeType capacity);
+  void AdoptBlock(iterator tmp, sizeType capacity, sizeType count);
+  void StealFrom(SmallVector &v);
+  void FreeStorage();
+};
+
+}  // namespace s21
+
+#include "s21_small_vector.tpp"
+
+#endif  // SRC_SMALL_VECTOR_S21_SMALL_VECTOR_H_
@@ -0,0 +1,411 @@
+#ifndef SRC_SMALL_VECTOR_S21_SMALL_VECTOR_TPP_
+#define SRC_SMALL_VECTOR_S21_SMALL_VECTOR_TPP_
+
+namespace s21 {
+
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector()
+    : arr_size_(0), arr_capacity_(N), arr_(InlineData()) {}
+
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(sizeType n) : SmallVector() {
+  Reserve(n);
+  std::uninitialized_value_construct_n(arr_, n);
+  arr_size_ = n;
+}
+
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(std::initializer_list<valueType> const &items)
+    : SmallVector() {
+  Reserve(items.size());
+  UninitializedCopy(items.begin(), items.end(), arr_);
+  arr_size_ = items.size();
+}
+
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(const SmallVector &v) : SmallVector() {
+  Reserve(v.arr_size_);
+  UninitializedCopy(v.Begin(), v.End(), arr_);
+  arr_size_ = v.arr_size_;
+}
+
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(SmallVector &&v) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : SmallVector() {
+  StealFrom(v);
+}
+
+template <typename T, size_t N>
+SmallVector<T, N>::~SmallVector() {
+  DestroyRange(Begin(), End());
+  FreeStorage();
+}
+
+template <typename T, size_t N>
+SmallVector<T, N> &SmallVector<T, N>::operator=(const SmallVector &v) {
+  if (this != &v) {
+    Clear();
+    Reserve(v.arr_size_);
+    UninitializedCopy(v.Begin(), v.End(), arr_);
+    arr_size_ = v.arr_size_;
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+SmallVector<T, N> &SmallVector<T, N>::operator=(SmallVector &&v) noexcept(
+    std::is_nothrow_move_constructible_v<T>) {
+  if (this != &v) {
+    Clear();
+    if (!IsInline()) {
+      FreeStorage();
+      arr_ = InlineData();
+      arr_capacity_ = N;
+    }
+    StealFrom(v);
+  }
+  return *this;
+}
+
+// Если оба вектора в куче, меняются только указатели
+template <typename T, size_t N>
+void SmallVector<T, N>::Swap(SmallVector &other) {
+  if (!IsInline() && !other.IsInline()) {
+    std::swap(arr_capacity_, other.arr_capacity_);
+    std::swap(arr_size_, other.arr_size_);
+    std::swap(arr_, other.arr_);
+    return;
+  }
+  SmallVector tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::reference SmallVector<T, N>::At(sizeType pos) {
+  if (pos >= arr_size_)
+    throw std::out_of_range(
+        "vector::At(): index (which is " + std::to_string(pos) +
+        ") >= Size this->Size() (which is " + std::to_string(arr_size_) + ")");
+  return arr_[pos];
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::reference
+SmallVector<T, N>::operator[](sizeType pos) {
+  return arr_[pos];
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::constReference SmallVector<T, N>::Front() const {
+  return *Begin();
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::constReference SmallVector<T, N>::Back() const {
+  return arr_[arr_size_ - 1];
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::iterator SmallVector<T, N>::Data() {
+  return arr_;
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::iterator SmallVector<T, N>::Begin() {
+  return arr_;
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::iterator SmallVector<T, N>::End() {
+  return arr_ + arr_size_;
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::constIterator SmallVector<T, N>::Data() const {
+  return arr_;
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::constIterator SmallVector<T, N>::Begin() const {
+  return arr_;
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::constIterator SmallVector<T, N>::End() const {
+  return arr_ + arr_size_;
+}
+
+template <typename T, size_t N>
+bool SmallVector<T, N>::Empty() const {
+  return arr_size_ == 0;
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::sizeType SmallVector<T, N>::Size() const {
+  return End() - Begin();
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::sizeType SmallVector<T, N>::MaxSize() const {
+  return std::numeric_limits<sizeType>::max() / sizeof(valueType) / 2;
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::Reserve(sizeType size) {
+  if (size > MaxSize()) {
+    throw std::length_error("Requested Size exceeds the maximum Size.");
+  }
+  if (arr_capacity_ >= size) {
+    return;
+  }
+  ReallocMemory(size);
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::sizeType SmallVector<T, N>::Capacity() const {
+  return arr_capacity_;
+}
+
+template <typename T, size_t N>
+bool SmallVector<T, N>::IsInline() const {
+  return static_cast<const void *>(arr_) == static_cast<const void *>(buffer_);
+}
+
+// Если элементы помещаются в буфер, они возвращаются из кучи обратно
+template <typename T, size_t N>
+void SmallVector<T, N>::ShrinkToFit() {
+  if (IsInline()) return;
+  if (arr_size_ <= N) {
+    UninitializedRelocate(arr_, arr_ + arr_size_, InlineData());
+    FreeStorage();
+    arr_ = InlineData();
+    arr_capacity_ = N;
+  } else if (arr_capacity_ != arr_size_) {
+    ReallocMemory(arr_size_);
+  }
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::Clear() {
+  DestroyRange(Begin(), End());
+  arr_size_ = 0;
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::iterator
+SmallVector<T, N>::Insert(iterator pos, constReference value) {
+  return Emplace(pos, value);
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::iterator
+SmallVector<T, N>::Insert(iterator pos, valueType &&value) {
+  return Emplace(pos, std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+typename SmallVector<T, N>::iterator
+SmallVector<T, N>::Emplace(constIterator pos, Args &&...args) {
+  sizeType position = pos - Begin();
+  if (position == arr_size_) {
+    EmplaceBack(std::forward<Args>(args)...);
+    return arr_ + position;
+  }
+  if (arr_size_ < arr_capacity_) {
+    EmplaceShifting(arr_, arr_size_, position, std::forward<Args>(args)...);
+    return arr_ + position;
+  }
+  sizeType capacity = GrowCapacity(arr_size_ + 1);
+  AdoptBlock(GrowAround<HeapAllocator<T>>(arr_, arr_size_, position, 1,
+                                          capacity,
+                                          [&args...](iterator place) {
+                                            new (place) valueType(
+                                                std::forward<Args>(args)...);
+                                          }),
+             capacity, 1);
+  return arr_ + position;
+}
+
+/*
+ * Вставка диапазона сдвигает хвост один раз. Для однопроходных итераторов
+ * элементы дописываются в конец и поворачиваются на место. Диапазон не
+ * должен указывать внутрь самого вектора.
+ */
+template <typename T, size_t N>
+template <typename InputIt>
+typename SmallVector<T, N>::iterator SmallVector<T, N>::Insert(iterator pos,
+                                                               InputIt first,
+                                                               InputIt last) {
+  sizeType position = pos - Begin();
+  using Category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (!std::is_base_of_v<std::forward_iterator_tag, Category>) {
+    sizeType old_size = arr_size_;
+    for (; first != last; ++first) PushBack(*first);
+    std::rotate(Begin() + position, Begin() + old_size, End());
+    return arr_ + position;
+  } else {
+    sizeType count = std::distance(first, last);
+    if (count == 0) return pos;
+    if (arr_size_ + count > arr_capacity_) {
+      sizeType capacity = GrowCapacity(arr_size_ + count);
+      AdoptBlock(GrowAround<HeapAllocator<T>>(arr_, arr_size_, position, count,
+                                              capacity,
+                                              [first, last](iterator place) {
+                                                std::uninitialized_copy(
+                                                    first, last, place);
+                                              }),
+                 capacity, count);
+    } else {
+      InsertShifting(arr_, arr_size_, position, first, last, count);
+    }
+    return arr_ + position;
+  }
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::iterator SmallVector<T, N>::Erase(iterator pos) {
+  return Erase(pos, pos + 1);
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::iterator SmallVector<T, N>::Erase(iterator first,
+                                                              iterator last) {
+  if (first == last) return first;
+  arr_size_ = EraseShifting(first, last, End()) - Begin();
+  return first;
+}
+
+/*
+ * Сдвигает оставляемые элементы к началу за один проход и возвращает новый
+ * конец; элементы после него остаются в перемещённом состоянии до Erase
+ */
+template <typename T, size_t N>
+template <typename Predicate>
+typename SmallVector<T, N>::iterator
+SmallVector<T, N>::RemoveIf(Predicate pred) {
+  return std::remove_if(Begin(), End(), pred);
+}
+
+template <typename T, size_t N>
+template <typename Predicate>
+typename SmallVector<T, N>::sizeType
+SmallVector<T, N>::EraseIf(Predicate pred) {
+  sizeType old_size = arr_size_;
+  Erase(RemoveIf(pred), End());
+  return old_size - arr_size_;
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::PushBack(constReference value) {
+  EmplaceBack(value);
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::PushBack(valueType &&value) {
+  EmplaceBack(std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+typename SmallVector<T, N>::reference
+SmallVector<T, N>::EmplaceBack(Args &&...args) {
+  if (arr_size_ == arr_capacity_) {
+    sizeType capacity = GrowCapacity(arr_size_ + 1);
+    AdoptBlock(GrowAround<HeapAllocator<T>>(
+                   arr_, arr_size_, arr_size_, 1, capacity,
+                   [&args...](iterator place) {
+                     new (place) valueType(std::forward<Args>(args)...);
+                   }),
+               capacity, 1);
+    return arr_[arr_size_ - 1];
+  }
+  new (arr_ + arr_size_) valueType(std::forward<Args>(args)...);
+  return arr_[arr_size_++];
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::PopBack() {
+  --arr_size_;
+  DestroyRange(End(), End() + 1);
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+typename SmallVector<T, N>::iterator
+SmallVector<T, N>::InsertMany(constIterator pos, Args &&...args) {
+  SmallVector tmp{std::forward<Args>(args)...};
+  iterator position = Begin() + (pos - Begin());
+  return Insert(position, std::make_move_iterator(tmp.Begin()),
+                std::make_move_iterator(tmp.End())) +
+         tmp.arr_size_;
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+void SmallVector<T, N>::InsertManyBack(Args &&...args) {
+  InsertMany(End(), std::forward<Args>(args)...);
+}
+
+// Ёмкость растёт вдвое, но не меньше required
+template <typename T, size_t N>
+typename SmallVector<T, N>::sizeType
+SmallVector<T, N>::GrowCapacity(sizeType required) const {
+  if (required > MaxSize()) {
+    throw std::length_error("Requested Size exceeds the maximum Size.");
+  }
+  sizeType capacity = arr_capacity_ * 2;
+  if (capacity > MaxSize()) capacity = MaxSize();
+  return std::max(capacity, required);
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::ReallocMemory(sizeType capacity) {
+  AdoptBlock(GrowAround<HeapAllocator<T>>(arr_, arr_size_, arr_size_, 0,
+                                          capacity, [](iterator) {}),
+             capacity, 0);
+}
+
+// Делает блок из GrowAround памятью вектора, в нём count новых элементов
+template <typename T, size_t N>
+void SmallVector<T, N>::AdoptBlock(iterator tmp, sizeType capacity,
+                                   sizeType count) {
+  FreeStorage();
+  arr_ = tmp;
+  arr_capacity_ = capacity;
+  arr_size_ += count;
+}
+
+template <typename T, size_t N>
+void SmallVector<T, N>::FreeStorage() {
+  if (!IsInline()) HeapAllocator<T>::Deallocate(arr_, arr_capacity_);
+}
+
+template <typename T, size_t N>
+typename SmallVector<T, N>::iterator SmallVector<T, N>::InlineData() {
+  return reinterpret_cast<iterator>(buffer_);
+}
+
+/*
+ * Забирает элементы v в пустой вектор со встроенным буфером: память кучи
+ * передаётся целиком, элементы из буфера v переносятся поштучно
+ */
+template <typename T, size_t N>
+void SmallVector<T, N>::StealFrom(SmallVector &v) {
+  if (v.IsInline()) {
+    UninitializedRelocate(v.Begin(), v.End(), arr_);
+  } else {
+    arr_ = v.arr_;
+    arr_capacity_ = v.arr_capacity_;
+    v.arr_ = v.InlineData();
+    v.arr_capacity_ = N;
+  }
+  arr_size_ = v.arr_size_;
+  v.arr_size_ = 0;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SMALL_VECTOR_S21_SMALL_VECTOR_TPP_
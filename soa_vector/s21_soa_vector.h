@@ -0,0 +1,206 @@
+#ifndef SRC_SOA_VECTOR_S21_SOA_VECTOR_H_
+#define SRC_SOA_VECTOR_S21_SOA_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * Вектор записей, в котором каждое поле хранится в своём Vector
+ * (struct-of-arrays). Цикл, читающий одно-два поля, проходит только по их
+ * столбцам, а не по целым записям, и столбец можно передать в simd:: или
+ * другой векторизованный код через Data<I>().
+ *
+ * Строка возвращается как std::tuple ссылок на элементы столбцов, поэтому
+ * работают структурные привязки и присваивание строки целиком:
+ *   auto [id, price] = soa[i];
+ *   soa[i] = std::make_tuple(7, 1.5);
+ */
+template <typename... Fields>
+class SoAVector {
+  static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+
+ public:
+  template <bool kConst>
+  class RowIterator;
+
+  using valueType = std::tuple<Fields...>;
+  using reference = std::tuple<Fields &...>;
+  using constReference = std::tuple<const Fields &...>;
+  using iterator = RowIterator<false>;
+  using constIterator = RowIterator<true>;
+  using sizeType = size_t;
+  template <size_t I>
+  using fieldType = std::tuple_element_t<I, valueType>;
+
+  // Итератор по строкам, разыменование даёт reference или constReference
+  template <bool kConst>
+  class RowIterator {
+    using Owner = std::conditional_t<kConst, const SoAVector, SoAVector>;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = valueType;
+    using difference_type = std::ptrdiff_t;
+    using reference =
+        std::conditional_t<kConst, SoAVector::constReference,
+                           SoAVector::reference>;
+    using pointer = void;
+
+    RowIterator() = default;
+    RowIterator(Owner *owner, sizeType pos) : owner_(owner), pos_(pos) {}
+    // iterator неявно приводится к constIterator
+    template <bool kFromMutable = !kConst,
+              typename = std::enable_if_t<kFromMutable>>
+    operator RowIterator<true>() const {
+      return {owner_, pos_};
+    }
+
+    reference operator*() const { return (*owner_)[pos_]; }
+    reference operator[](difference_type n) const {
+      return (*owner_)[pos_ + n];
+    }
+
+    RowIterator &operator++() {
+      ++pos_;
+      return *this;
+    }
+    RowIterator operator++(int) { return {owner_, pos_++}; }
+    RowIterator &operator--() {
+      --pos_;
+      return *this;
+    }
+    RowIterator operator--(int) { return {owner_, pos_--}; }
+    RowIterator &operator+=(difference_type n) {
+      pos_ += n;
+      return *this;
+    }
+    RowIterator &operator-=(difference_type n) {
+      pos_ -= n;
+      return *this;
+    }
+    RowIterator operator+(difference_type n) const {
+      return {owner_, pos_ + n};
+    }
+    RowIterator operator-(difference_type n) const {
+      return {owner_, pos_ - n};
+    }
+    difference_type operator-(const RowIterator &other) const {
+      return static_cast<difference_type>(pos_) -
+             static_cast<difference_type>(other.pos_);
+    }
+
+    bool operator==(const RowIterator &other) const {
+      return pos_ == other.pos_;
+    }
+    bool operator!=(const RowIterator &other) const {
+      return pos_ != other.pos_;
+    }
+    bool operator<(const RowIterator &other) const {
+      return pos_ < other.pos_;
+    }
+    bool operator>(const RowIterator &other) const {
+      return pos_ > other.pos_;
+    }
+    bool operator<=(const RowIterator &other) const {
+      return pos_ <= other.pos_;
+    }
+    bool operator>=(const RowIterator &other) const {
+      return pos_ >= other.pos_;
+    }
+
+   private:
+    Owner *owner_ = nullptr;
+    sizeType pos_ = 0;
+  };
+
+  SoAVector() = default;
+  explicit SoAVector(sizeType n);
+  SoAVector(std::initializer_list<valueType> const &items);
+
+  /*
+   * Преобразование из массива записей и обратно. Для каждого столбца
+   * передаётся указатель на соответствующее поле записи, например
+   * SoAVector<int, double>::FromRecords(records, &Order::id, &Order::price)
+   */
+  template <typename Record>
+  static SoAVector FromRecords(const Vector<Record> &records,
+                               Fields Record::*...members);
+  // Record должен конструироваться по умолчанию, остальные поля не заданы
+  template <typename Record>
+  Vector<Record> ToRecords(Fields Record::*...members) const;
+
+  void Swap(SoAVector &other);
+
+  reference At(sizeType pos);
+  constReference At(sizeType pos) const;
+  reference operator[](sizeType pos);
+  constReference operator[](sizeType pos) const;
+
+  constReference Front() const;
+  constReference Back() const;
+
+  // Столбец поля I и указатель на его начало
+  template <size_t I>
+  Vector<fieldType<I>> &Column();
+  template <size_t I>
+  const Vector<fieldType<I>> &Column() const;
+  template <size_t I>
+  fieldType<I> *Data();
+  template <size_t I>
+  const fieldType<I> *Data() const;
+
+  iterator Begin();
+  iterator End();
+  constIterator Begin() const;
+  constIterator End() const;
+
+  bool Empty() const;
+  sizeType Size() const;
+  sizeType MaxSize() const;
+
+  void Reserve(sizeType size);
+  // Наименьшая из ёмкостей столбцов
+  sizeType Capacity() const;
+  void ShrinkToFit();
+  void Clear();
+
+  void PushBack(const valueType &row);
+  void PushBack(valueType &&row);
+  // По одному аргументу на столбец
+  template <typename... Args>
+  reference EmplaceBack(Args &&...args);
+  void PopBack();
+
+ private:
+  using Indices = std::index_sequence_for<Fields...>;
+
+  template <size_t... I>
+  reference Row(sizeType pos, std::index_sequence<I...>);
+  template <size_t... I>
+  constReference Row(sizeType pos, std::index_sequence<I...>) const;
+  template <typename Tuple, size_t... I>
+  void PushRow(Tuple &&row, std::index_sequence<I...>);
+  template <typename Record>
+  void PushRecord(const Record &record, Fields Record::*...members);
+  template <typename Record, size_t... I>
+  Record MakeRecord(sizeType pos, std::index_sequence<I...>,
+                    Fields Record::*...members) const;
+
+  std::tuple<Vector<Fields>...> columns_;
+};
+
+}  // namespace s21
+
+#include "s21_soa_vector.tpp"
+
+#endif  // SRC_SOA_VECTOR_S21_SOA_VECTOR_H_
@@ -0,0 +1,258 @@
+#ifndef SRC_SOA_VECTOR_S21_SOA_VECTOR_TPP_
+#define SRC_SOA_VECTOR_S21_SOA_VECTOR_TPP_
+
+namespace s21 {
+
+template <typename... Fields>
+SoAVector<Fields...>::SoAVector(sizeType n)
+    : columns_(Vector<Fields>(n)...) {}
+
+template <typename... Fields>
+SoAVector<Fields...>::SoAVector(
+    std::initializer_list<valueType> const &items) {
+  Reserve(items.size());
+  for (const valueType &row : items) {
+    PushBack(row);
+  }
+}
+
+template <typename... Fields>
+template <typename Record>
+SoAVector<Fields...> SoAVector<Fields...>::FromRecords(
+    const Vector<Record> &records, Fields Record::*...members) {
+  SoAVector result;
+  result.Reserve(records.Size());
+  for (auto it = records.Begin(); it != records.End(); ++it) {
+    result.PushRecord(*it, members...);
+  }
+  return result;
+}
+
+template <typename... Fields>
+template <typename Record>
+Vector<Record> SoAVector<Fields...>::ToRecords(
+    Fields Record::*...members) const {
+  Vector<Record> records;
+  records.Reserve(Size());
+  for (sizeType pos = 0; pos < Size(); ++pos) {
+    records.PushBack(MakeRecord<Record>(pos, Indices{}, members...));
+  }
+  return records;
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::Swap(SoAVector &other) {
+  columns_.swap(other.columns_);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::reference SoAVector<Fields...>::At(
+    sizeType pos) {
+  if (pos >= Size()) throw std::out_of_range("Index out of range");
+  return Row(pos, Indices{});
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::constReference SoAVector<Fields...>::At(
+    sizeType pos) const {
+  if (pos >= Size()) throw std::out_of_range("Index out of range");
+  return Row(pos, Indices{});
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::reference SoAVector<Fields...>::operator[](
+    sizeType pos) {
+  return Row(pos, Indices{});
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::constReference
+SoAVector<Fields...>::operator[](sizeType pos) const {
+  return Row(pos, Indices{});
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::constReference SoAVector<Fields...>::Front()
+    const {
+  if (Empty()) throw std::out_of_range("SoAVector is empty");
+  return Row(0, Indices{});
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::constReference SoAVector<Fields...>::Back()
+    const {
+  if (Empty()) throw std::out_of_range("SoAVector is empty");
+  return Row(Size() - 1, Indices{});
+}
+
+template <typename... Fields>
+template <size_t I>
+Vector<typename SoAVector<Fields...>::template fieldType<I>>
+    &SoAVector<Fields...>::Column() {
+  return std::get<I>(columns_);
+}
+
+template <typename... Fields>
+template <size_t I>
+const Vector<typename SoAVector<Fields...>::template fieldType<I>>
+    &SoAVector<Fields...>::Column() const {
+  return std::get<I>(columns_);
+}
+
+template <typename... Fields>
+template <size_t I>
+typename SoAVector<Fields...>::template fieldType<I>
+    *SoAVector<Fields...>::Data() {
+  return std::get<I>(columns_).Data();
+}
+
+template <typename... Fields>
+template <size_t I>
+const typename SoAVector<Fields...>::template fieldType<I>
+    *SoAVector<Fields...>::Data() const {
+  return std::get<I>(columns_).Data();
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::iterator SoAVector<Fields...>::Begin() {
+  return iterator(this, 0);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::iterator SoAVector<Fields...>::End() {
+  return iterator(this, Size());
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::constIterator SoAVector<Fields...>::Begin()
+    const {
+  return constIterator(this, 0);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::constIterator SoAVector<Fields...>::End()
+    const {
+  return constIterator(this, Size());
+}
+
+template <typename... Fields>
+bool SoAVector<Fields...>::Empty() const {
+  return Size() == 0;
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::sizeType SoAVector<Fields...>::Size() const {
+  return std::get<0>(columns_).Size();
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::sizeType SoAVector<Fields...>::MaxSize()
+    const {
+  return std::apply(
+      [](const auto &...column) { return std::min({column.MaxSize()...}); },
+      columns_);
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::Reserve(sizeType size) {
+  std::apply([size](auto &...column) { (column.Reserve(size), ...); },
+             columns_);
+}
+
+template <typename... Fields>
+typename SoAVector<Fields...>::sizeType SoAVector<Fields...>::Capacity()
+    const {
+  return std::apply(
+      [](const auto &...column) { return std::min({column.Capacity()...}); },
+      columns_);
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::ShrinkToFit() {
+  std::apply([](auto &...column) { (column.ShrinkToFit(), ...); }, columns_);
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::Clear() {
+  std::apply([](auto &...column) { (column.Clear(), ...); }, columns_);
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::PushBack(const valueType &row) {
+  PushRow(row, Indices{});
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::PushBack(valueType &&row) {
+  PushRow(std::move(row), Indices{});
+}
+
+template <typename... Fields>
+template <typename... Args>
+typename SoAVector<Fields...>::reference SoAVector<Fields...>::EmplaceBack(
+    Args &&...args) {
+  static_assert(sizeof...(Args) == sizeof...(Fields),
+                "EmplaceBack takes one argument per field");
+  PushRow(std::forward_as_tuple(std::forward<Args>(args)...), Indices{});
+  return Row(Size() - 1, Indices{});
+}
+
+template <typename... Fields>
+void SoAVector<Fields...>::PopBack() {
+  std::apply([](auto &...column) { (column.PopBack(), ...); }, columns_);
+}
+
+template <typename... Fields>
+template <size_t... I>
+typename SoAVector<Fields...>::reference SoAVector<Fields...>::Row(
+    sizeType pos, std::index_sequence<I...>) {
+  return reference(std::get<I>(columns_).Data()[pos]...);
+}
+
+template <typename... Fields>
+template <size_t... I>
+typename SoAVector<Fields...>::constReference SoAVector<Fields...>::Row(
+    sizeType pos, std::index_sequence<I...>) const {
+  return constReference(std::get<I>(columns_).Data()[pos]...);
+}
+
+/*
+ * Строка добавляется во все столбцы по очереди. Если конструктор поля
+ * бросит исключение, уже добавленные поля этой строки удаляются, чтобы
+ * столбцы остались одной длины.
+ */
+template <typename... Fields>
+template <typename Tuple, size_t... I>
+void SoAVector<Fields...>::PushRow(Tuple &&row, std::index_sequence<I...>) {
+  sizeType pushed = 0;
+  try {
+    ((std::get<I>(columns_).EmplaceBack(
+          std::get<I>(std::forward<Tuple>(row))),
+      ++pushed),
+     ...);
+  } catch (...) {
+    ((I < pushed ? std::get<I>(columns_).PopBack() : void()), ...);
+    throw;
+  }
+}
+
+template <typename... Fields>
+template <typename Record>
+void SoAVector<Fields...>::PushRecord(const Record &record,
+                                      Fields Record::*...members) {
+  PushRow(std::forward_as_tuple(record.*members...), Indices{});
+}
+
+template <typename... Fields>
+template <typename Record, size_t... I>
+Record SoAVector<Fields...>::MakeRecord(sizeType pos,
+                                        std::index_sequence<I...>,
+                                        Fields Record::*...members) const {
+  Record record{};
+  ((record.*members = std::get<I>(columns_).Data()[pos]), ...);
+  return record;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOA_VECTOR_S21_SOA_VECTOR_TPP_
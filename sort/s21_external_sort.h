@@ -0,0 +1,75 @@
+#ifndef SRC_SORT_S21_EXTERNAL_SORT_H_
+#define SRC_SORT_S21_EXTERNAL_SORT_H_
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../parallel/s21_parallel.h"
+#include "../thread_pool/s21_thread_pool.h"
+#include "../vector/s21_vector.h"
+#include "s21_sort.h"
+
+namespace s21 {
+
+/*
+ * Сортировка файла записей T, который не помещается в память. Файл — это
+ * записи подряд без заголовка, как их пишет fwrite.
+ *
+ * Сначала входной файл читается кусками по трети бюджета памяти, куски
+ * сортируются (параллельно, если задан пул) и записываются во временные
+ * файлы, пока читается и сортируется следующий кусок. Затем серии
+ * сливаются деревом проигравших: каждое следующее значение стоит log2(k)
+ * сравнений. Чтение каждой серии и запись результата идут в фоне блоками
+ * по два буфера. Если серий больше, чем позволяет бюджет при блоке не
+ * меньше kMinExternalBlockBytes, слияние выполняется в несколько проходов.
+ *
+ * Временные файлы удаляются сразу после создания и исчезают, даже если
+ * процесс завершится аварийно. Входной и выходной файлы могут совпадать.
+ * Если все записи помещаются в бюджет, файл сортируется в памяти.
+ */
+
+// Наименьший блок чтения и записи при слиянии
+inline constexpr size_t kMinExternalBlockBytes = 1 << 16;
+
+struct ExternalSortOptions {
+  // Память под буферы сортировки и слияния
+  size_t memory_bytes = size_t{256} << 20;
+  // Каталог временных файлов, по умолчанию $TMPDIR или /tmp
+  std::string temp_dir;
+  // Пул для сортировки кусков, без него куски сортируются в этом потоке
+  ThreadPool *pool = nullptr;
+};
+
+struct ExternalSortStats {
+  size_t elements = 0;
+  // Отсортированные серии после первого этапа
+  size_t runs = 0;
+  size_t merge_passes = 0;
+};
+
+template <typename T, typename Compare = std::less<>>
+ExternalSortStats ExternalSort(const std::string &input,
+                               const std::string &output,
+                               const ExternalSortOptions &options = {},
+                               Compare comp = {});
+
+}  // namespace s21
+
+#include "s21_external_sort.tpp"
+
+#endif  // SRC_SORT_S21_EXTERNAL_SORT_H_
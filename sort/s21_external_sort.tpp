@@ -0,0 +1,358 @@
+#ifndef SRC_SORT_S21_EXTERNAL_SORT_TPP_
+#define SRC_SORT_S21_EXTERNAL_SORT_TPP_
+
+namespace s21 {
+
+namespace external_sort_detail {
+
+struct FileCloser {
+  void operator()(std::FILE *file) const { std::fclose(file); }
+};
+
+using FilePtr = std::unique_ptr<std::FILE, FileCloser>;
+
+inline FilePtr OpenFile(const std::string &path, const char *mode) {
+  FilePtr file(std::fopen(path.c_str(), mode));
+  if (!file) {
+    throw std::system_error(errno, std::generic_category(), "fopen " + path);
+  }
+  return file;
+}
+
+// Безымянный временный файл: удаляется из каталога сразу после создания
+inline FilePtr CreateRunFile(const std::string &dir) {
+  std::string path = dir + "/s21_sort_XXXXXX";
+  int fd = mkstemp(path.data());
+  if (fd < 0) {
+    throw std::system_error(errno, std::generic_category(), "mkstemp " + path);
+  }
+  unlink(path.c_str());
+  FilePtr file(fdopen(fd, "w+b"));
+  if (!file) {
+    int error = errno;
+    close(fd);
+    throw std::system_error(error, std::generic_category(), "fdopen");
+  }
+  return file;
+}
+
+// Закрывает файл с проверкой: fclose сбрасывает на диск остаток буфера
+inline void CloseFile(FilePtr file, const std::string &path) {
+  if (std::fclose(file.release()) != 0) {
+    throw std::system_error(errno, std::generic_category(), "fclose " + path);
+  }
+}
+
+template <typename T>
+size_t CountRecords(const std::string &path) {
+  struct stat info;
+  if (stat(path.c_str(), &info) != 0) {
+    throw std::system_error(errno, std::generic_category(), "stat " + path);
+  }
+  size_t bytes = static_cast<size_t>(info.st_size);
+  if (bytes % sizeof(T) != 0) {
+    throw std::runtime_error("File size is not a multiple of the record: " +
+                             path);
+  }
+  return bytes / sizeof(T);
+}
+
+inline std::string TempDir(const ExternalSortOptions &options) {
+  if (!options.temp_dir.empty()) return options.temp_dir;
+  const char *dir = std::getenv("TMPDIR");
+  return dir && *dir ? dir : "/tmp";
+}
+
+template <typename T>
+size_t ReadBlock(std::FILE *file, T *data, size_t count) {
+  if (count == 0) return 0;
+  size_t read = std::fread(data, sizeof(T), count, file);
+  if (read < count && std::ferror(file)) {
+    throw std::system_error(errno, std::generic_category(), "fread");
+  }
+  return read;
+}
+
+template <typename T>
+void WriteBlock(std::FILE *file, const T *data, size_t count) {
+  if (count == 0) return;
+  if (std::fwrite(data, sizeof(T), count, file) != count) {
+    throw std::system_error(errno, std::generic_category(), "fwrite");
+  }
+}
+
+/*
+ * Читает серию блоками в два буфера: пока слияние берёт значения из
+ * одного, следующий блок читается в другой.
+ */
+template <typename T>
+class BlockReader {
+ public:
+  BlockReader(std::FILE *file, size_t block)
+      : file_(file),
+        block_(block),
+        buffers_{Vector<T>(block), Vector<T>(block)} {
+    count_ = ReadBlock(file_, buffers_[0].Data(), block_);
+    Prefetch();
+  }
+
+  bool Done() const { return pos_ == count_; }
+  const T &Front() const { return data_[pos_]; }
+
+  void Pop() {
+    if (++pos_ == count_ && pending_.valid()) {
+      count_ = pending_.get();
+      current_ ^= 1;
+      pos_ = 0;
+      Prefetch();
+    }
+  }
+
+ private:
+  void Prefetch() {
+    data_ = buffers_[current_].Data();
+    if (count_ < block_) return;
+    std::FILE *file = file_;
+    T *next = buffers_[current_ ^ 1].Data();
+    size_t block = block_;
+    pending_ = std::async(std::launch::async, [file, next, block] {
+      return ReadBlock(file, next, block);
+    });
+  }
+
+  std::FILE *file_;
+  size_t block_;
+  Vector<T> buffers_[2];
+  const T *data_ = nullptr;
+  size_t current_ = 0;
+  size_t pos_ = 0;
+  size_t count_ = 0;
+  // Объявлен последним: деструктор дождётся чтения до освобождения буферов
+  std::future<size_t> pending_;
+};
+
+// Копит результат в одном буфере, пока другой пишется в фоне
+template <typename T>
+class BlockWriter {
+ public:
+  BlockWriter(std::FILE *file, size_t block)
+      : file_(file),
+        block_(block),
+        buffers_{Vector<T>(block), Vector<T>(block)} {
+    data_ = buffers_[0].Data();
+  }
+
+  void Push(const T &value) {
+    data_[count_++] = value;
+    if (count_ == block_) Flush();
+  }
+
+  void Finish() {
+    if (count_ > 0) Flush();
+    if (pending_.valid()) pending_.get();
+    if (std::fflush(file_) != 0) {
+      throw std::system_error(errno, std::generic_category(), "fflush");
+    }
+  }
+
+ private:
+  void Flush() {
+    if (pending_.valid()) pending_.get();
+    std::FILE *file = file_;
+    const T *full = data_;
+    size_t count = count_;
+    pending_ = std::async(std::launch::async, [file, full, count] {
+      WriteBlock(file, full, count);
+    });
+    current_ ^= 1;
+    data_ = buffers_[current_].Data();
+    count_ = 0;
+  }
+
+  std::FILE *file_;
+  size_t block_;
+  Vector<T> buffers_[2];
+  T *data_ = nullptr;
+  size_t current_ = 0;
+  size_t count_ = 0;
+  std::future<void> pending_;
+};
+
+/*
+ * Дерево проигравших над k источниками. Листья — источники с номерами
+ * k..2k-1 в нумерации кучи, во внутренних узлах 1..k-1 хранится
+ * проигравший в матче этого узла, в nodes_[0] — общий победитель. После
+ * того как победитель выдал значение, переигрываются только матчи на пути
+ * от его листа к корню. Исчерпанный источник проигрывает всем, при
+ * равенстве побеждает источник с меньшим номером.
+ */
+template <typename Source, typename Compare>
+class LoserTree {
+ public:
+  LoserTree(std::vector<Source> &sources, Compare comp)
+      : sources_(sources), comp_(comp), nodes_(sources.size()) {
+    if (!nodes_.empty()) nodes_[0] = Build(1);
+  }
+
+  bool Empty() const { return nodes_.empty() || sources_[nodes_[0]].Done(); }
+  size_t Winner() const { return nodes_[0]; }
+
+  void Replay(size_t leaf) {
+    size_t winner = leaf;
+    for (size_t node = (leaf + nodes_.size()) / 2; node > 0; node /= 2) {
+      if (Beats(nodes_[node], winner)) std::swap(nodes_[node], winner);
+    }
+    nodes_[0] = winner;
+  }
+
+ private:
+  size_t Build(size_t node) {
+    if (node >= nodes_.size()) return node - nodes_.size();
+    size_t left = Build(2 * node);
+    size_t right = Build(2 * node + 1);
+    if (Beats(left, right)) {
+      nodes_[node] = right;
+      return left;
+    }
+    nodes_[node] = left;
+    return right;
+  }
+
+  bool Beats(size_t a, size_t b) const {
+    if (sources_[a].Done()) return false;
+    if (sources_[b].Done()) return true;
+    if (comp_(sources_[a].Front(), sources_[b].Front())) return true;
+    if (comp_(sources_[b].Front(), sources_[a].Front())) return false;
+    return a < b;
+  }
+
+  std::vector<Source> &sources_;
+  Compare comp_;
+  std::vector<size_t> nodes_;
+};
+
+// Два буфера на каждую серию и два на результат
+template <typename T>
+size_t MergeBlock(size_t memory_bytes, size_t fan_in) {
+  return std::max<size_t>(1, memory_bytes / ((2 * fan_in + 2) * sizeof(T)));
+}
+
+template <typename T>
+size_t MaxFanIn(size_t memory_bytes) {
+  size_t block = std::max(kMinExternalBlockBytes, sizeof(T));
+  return std::max<size_t>(2, memory_bytes / (2 * block) - 1);
+}
+
+template <typename T, typename Compare>
+void MergeRuns(FilePtr *runs, size_t count, std::FILE *output,
+               size_t memory_bytes, Compare comp) {
+  size_t block = MergeBlock<T>(memory_bytes, count);
+  std::vector<BlockReader<T>> readers;
+  readers.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    std::rewind(runs[i].get());
+    readers.emplace_back(runs[i].get(), block);
+  }
+  BlockWriter<T> writer(output, block);
+  LoserTree<BlockReader<T>, Compare> tree(readers, comp);
+  while (!tree.Empty()) {
+    size_t winner = tree.Winner();
+    writer.Push(readers[winner].Front());
+    readers[winner].Pop();
+    tree.Replay(winner);
+  }
+  writer.Finish();
+}
+
+// В одном потоке Sort быстрее: для ключей-чисел он выбирает RadixSort
+template <typename T, typename Compare>
+void SortChunk(T *first, T *last, ThreadPool *pool, Compare comp) {
+  if (pool && pool->Size() > 1) {
+    parallel::Sort(*pool, first, last, comp);
+  } else {
+    Sort(first, last, comp);
+  }
+}
+
+}  // namespace external_sort_detail
+
+template <typename T, typename Compare>
+ExternalSortStats ExternalSort(const std::string &input,
+                               const std::string &output,
+                               const ExternalSortOptions &options,
+                               Compare comp) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "ExternalSort stores T as raw bytes in files");
+  namespace detail = external_sort_detail;
+  if (options.memory_bytes < 8 * kMinExternalBlockBytes) {
+    throw std::invalid_argument("ExternalSort memory budget is too small");
+  }
+  std::string temp_dir = detail::TempDir(options);
+  ExternalSortStats stats;
+  stats.elements = detail::CountRecords<T>(input);
+
+  // Два буфера: один сортируется, другой пишется; треть — запас сортировке
+  size_t chunk = std::max<size_t>(1, options.memory_bytes / (3 * sizeof(T)));
+  std::vector<detail::FilePtr> runs;
+  {
+    detail::FilePtr in = detail::OpenFile(input, "rb");
+    if (stats.elements <= chunk) {
+      // Всё помещается в память: сортируем и пишем сразу в output
+      Vector<T> values(stats.elements);
+      size_t count = detail::ReadBlock(in.get(), values.Data(), values.Size());
+      in.reset();
+      detail::SortChunk(values.Data(), values.Data() + count, options.pool,
+                        comp);
+      detail::FilePtr out = detail::OpenFile(output, "wb");
+      detail::WriteBlock(out.get(), values.Data(), count);
+      detail::CloseFile(std::move(out), output);
+      stats.runs = count > 0;
+      return stats;
+    }
+    Vector<T> buffers[2] = {Vector<T>(chunk), Vector<T>(chunk)};
+    std::future<void> writing;
+    for (size_t current = 0;; current ^= 1) {
+      T *data = buffers[current].Data();
+      size_t count = detail::ReadBlock(in.get(), data, chunk);
+      if (count == 0) break;
+      detail::SortChunk(data, data + count, options.pool, comp);
+      if (writing.valid()) writing.get();
+      runs.push_back(detail::CreateRunFile(temp_dir));
+      std::FILE *run = runs.back().get();
+      writing = std::async(std::launch::async, [run, data, count] {
+        detail::WriteBlock(run, data, count);
+      });
+      if (count < chunk) break;
+    }
+    if (writing.valid()) writing.get();
+  }
+  stats.runs = runs.size();
+
+  size_t fan_in = detail::MaxFanIn<T>(options.memory_bytes);
+  while (runs.size() > fan_in) {
+    std::vector<detail::FilePtr> merged;
+    for (size_t first = 0; first < runs.size(); first += fan_in) {
+      size_t count = std::min(fan_in, runs.size() - first);
+      if (count == 1) {
+        merged.push_back(std::move(runs[first]));
+        continue;
+      }
+      merged.push_back(detail::CreateRunFile(temp_dir));
+      detail::MergeRuns<T>(&runs[first], count, merged.back().get(),
+                           options.memory_bytes, comp);
+    }
+    runs = std::move(merged);
+    ++stats.merge_passes;
+  }
+
+  detail::FilePtr out = detail::OpenFile(output, "wb");
+  detail::MergeRuns<T>(runs.data(), runs.size(), out.get(),
+                       options.memory_bytes, comp);
+  detail::CloseFile(std::move(out), output);
+  ++stats.merge_passes;
+  return stats;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SORT_S21_EXTERNAL_SORT_TPP_
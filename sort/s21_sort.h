@@ -0,0 +1,63 @@
+#ifndef SRC_SORT_S21_SORT_H_
+#define SRC_SORT_S21_SORT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+/*
+ * Сортировки для непрерывных диапазонов, например Vector::Data() или
+ * Array::Data().
+ *
+ * PdqSort — pattern-defeating quicksort: медиана из трёх (или из девяти
+ * для длинных диапазонов), распознавание уже упорядоченных участков через
+ * ограниченную сортировку вставками и переход на heapsort при плохих
+ * опорных элементах, поэтому худший случай O(n log n).
+ *
+ * RadixSort — устойчивая LSD-сортировка целых и float/double. Ключ
+ * отображается в беззнаковое целое с тем же порядком: у знаковых
+ * инвертируется старший бит, у отрицательных float инвертируются все биты.
+ * Поэтому -0.0 окажется перед +0.0, а NaN — по краям в зависимости от
+ * знака. Нужен буфер на size элементов. На больших массивах первый проход
+ * раскладывает элементы по старшей цифре, и остальные проходы идут внутри
+ * корзин, которые помещаются в кэш.
+ *
+ * Sort выбирает RadixSort для длинных диапазонов поддерживаемых типов с
+ * порядком по возрастанию, иначе PdqSort.
+ */
+
+// Ширина цифры RadixSort в битах, kAuto подбирает её по типу и размеру
+enum class RadixDigit { kAuto = 0, k8 = 8, k11 = 11, k16 = 16 };
+
+// Типы, которые умеет сортировать RadixSort
+template <typename T>
+inline constexpr bool kRadixSortable =
+    (std::is_integral_v<T> && !std::is_same_v<T, bool>) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+// С меньшего размера выгоднее PdqSort: гистограммы не окупаются
+inline constexpr size_t kRadixSortThreshold = 1 << 10;
+
+template <typename RandomIt, typename Compare = std::less<>>
+void PdqSort(RandomIt first, RandomIt last, Compare comp = {});
+
+template <typename T>
+void RadixSort(T *first, T *last, RadixDigit digit = RadixDigit::kAuto);
+
+template <typename RandomIt, typename Compare = std::less<>>
+void Sort(RandomIt first, RandomIt last, Compare comp = {});
+
+}  // namespace s21
+
+#include "s21_sort.tpp"
+
+#endif  // SRC_SORT_S21_SORT_H_
@@ -0,0 +1,426 @@
+#ifndef SRC_SORT_S21_SORT_TPP_
+#define SRC_SORT_S21_SORT_TPP_
+
+namespace s21 {
+
+namespace sort_detail {
+
+// Короче этого диапазоны сортируются вставками
+inline constexpr ptrdiff_t kInsertionSortThreshold = 24;
+// Длиннее этого опорный элемент выбирается медианой из девяти
+inline constexpr ptrdiff_t kNintherThreshold = 128;
+// Сколько перемещений допускает PartialInsertionSort, прежде чем сдаться
+inline constexpr ptrdiff_t kPartialInsertionSortLimit = 8;
+
+template <typename RandomIt, typename Compare>
+void InsertionSort(RandomIt begin, RandomIt end, Compare &comp) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  if (begin == end) return;
+  for (RandomIt cur = begin + 1; cur != end; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Слева от begin должен быть элемент не больше любого из диапазона
+template <typename RandomIt, typename Compare>
+void UnguardedInsertionSort(RandomIt begin, RandomIt end, Compare &comp) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  if (begin == end) return;
+  for (RandomIt cur = begin + 1; cur != end; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+    }
+  }
+}
+
+// Сортирует вставками, пока перемещений немного. false, если сдалась
+template <typename RandomIt, typename Compare>
+bool PartialInsertionSort(RandomIt begin, RandomIt end, Compare &comp) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  if (begin == end) return true;
+  ptrdiff_t moves = 0;
+  for (RandomIt cur = begin + 1; cur != end; ++cur) {
+    RandomIt sift = cur;
+    RandomIt sift_1 = cur - 1;
+    if (comp(*sift, *sift_1)) {
+      T tmp = std::move(*sift);
+      do {
+        *sift-- = std::move(*sift_1);
+      } while (sift != begin && comp(tmp, *--sift_1));
+      *sift = std::move(tmp);
+      moves += cur - sift;
+    }
+    if (moves > kPartialInsertionSortLimit) return false;
+  }
+  return true;
+}
+
+template <typename RandomIt, typename Compare>
+void Sort2(RandomIt a, RandomIt b, Compare &comp) {
+  if (comp(*b, *a)) std::iter_swap(a, b);
+}
+
+// Медиана трёх оказывается в b
+template <typename RandomIt, typename Compare>
+void Sort3(RandomIt a, RandomIt b, RandomIt c, Compare &comp) {
+  Sort2(a, b, comp);
+  Sort2(b, c, comp);
+  Sort2(a, b, comp);
+}
+
+/*
+ * Разбиение вокруг *begin: меньшие налево, остальные направо. Возвращает
+ * позицию опорного элемента и признак того, что перестановок не было.
+ * Выбор опорного элемента медианой гарантирует, что циклы ниже не выйдут
+ * за границы без проверок.
+ */
+template <typename RandomIt, typename Compare>
+std::pair<RandomIt, bool> PartitionRight(RandomIt begin, RandomIt end,
+                                         Compare &comp) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  T pivot(std::move(*begin));
+  RandomIt first = begin;
+  RandomIt last = end;
+  while (comp(*++first, pivot)) {
+  }
+  if (first - 1 == begin) {
+    while (first < last && !comp(*--last, pivot)) {
+    }
+  } else {
+    while (!comp(*--last, pivot)) {
+    }
+  }
+  bool already_partitioned = first >= last;
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(*++first, pivot)) {
+    }
+    while (!comp(*--last, pivot)) {
+    }
+  }
+  RandomIt pivot_pos = first - 1;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return {pivot_pos, already_partitioned};
+}
+
+// Разбиение, при котором равные опорному уходят налево. Используется,
+// когда опорный равен элементу перед диапазоном, то есть много повторов
+template <typename RandomIt, typename Compare>
+RandomIt PartitionLeft(RandomIt begin, RandomIt end, Compare &comp) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  T pivot(std::move(*begin));
+  RandomIt first = begin;
+  RandomIt last = end;
+  while (comp(pivot, *--last)) {
+  }
+  if (last + 1 == end) {
+    while (first < last && !comp(pivot, *++first)) {
+    }
+  } else {
+    while (!comp(pivot, *++first)) {
+    }
+  }
+  while (first < last) {
+    std::iter_swap(first, last);
+    while (comp(pivot, *--last)) {
+    }
+    while (!comp(pivot, *++first)) {
+    }
+  }
+  RandomIt pivot_pos = last;
+  *begin = std::move(*pivot_pos);
+  *pivot_pos = std::move(pivot);
+  return pivot_pos;
+}
+
+// Меняет местами несколько элементов, чтобы сломать неудачный паттерн
+template <typename RandomIt>
+void BreakPatterns(RandomIt begin, RandomIt pivot_pos, RandomIt end) {
+  ptrdiff_t l_size = pivot_pos - begin;
+  ptrdiff_t r_size = end - (pivot_pos + 1);
+  if (l_size >= kInsertionSortThreshold) {
+    std::iter_swap(begin, begin + l_size / 4);
+    std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+    if (l_size > kNintherThreshold) {
+      std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+      std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+      std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+      std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+    }
+  }
+  if (r_size >= kInsertionSortThreshold) {
+    std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+    std::iter_swap(end - 1, end - r_size / 4);
+    if (r_size > kNintherThreshold) {
+      std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+      std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+      std::iter_swap(end - 2, end - (1 + r_size / 4));
+      std::iter_swap(end - 3, end - (2 + r_size / 4));
+    }
+  }
+}
+
+/*
+ * bad_allowed — сколько ещё сильно несбалансированных разбиений можно
+ * допустить до перехода на heapsort. leftmost — диапазон начинается с
+ * начала сортируемого массива, иначе слева от него лежит элемент не больше
+ * всех элементов диапазона.
+ */
+template <typename RandomIt, typename Compare>
+void PdqSortLoop(RandomIt begin, RandomIt end, Compare &comp, int bad_allowed,
+                 bool leftmost) {
+  while (true) {
+    ptrdiff_t size = end - begin;
+    if (size < kInsertionSortThreshold) {
+      if (leftmost) {
+        InsertionSort(begin, end, comp);
+      } else {
+        UnguardedInsertionSort(begin, end, comp);
+      }
+      return;
+    }
+
+    // Опорный элемент ставится в *begin
+    ptrdiff_t half = size / 2;
+    if (size > kNintherThreshold) {
+      Sort3(begin, begin + half, end - 1, comp);
+      Sort3(begin + 1, begin + (half - 1), end - 2, comp);
+      Sort3(begin + 2, begin + (half + 1), end - 3, comp);
+      Sort3(begin + (half - 1), begin + half, begin + (half + 1), comp);
+      std::iter_swap(begin, begin + half);
+    } else {
+      Sort3(begin + half, begin, end - 1, comp);
+    }
+
+    // Опорный равен элементу слева: все равные ему отделяются за один проход
+    if (!leftmost && !comp(*(begin - 1), *begin)) {
+      begin = PartitionLeft(begin, end, comp) + 1;
+      continue;
+    }
+
+    auto [pivot_pos, already_partitioned] =
+        PartitionRight(begin, end, comp);
+    ptrdiff_t l_size = pivot_pos - begin;
+    ptrdiff_t r_size = end - (pivot_pos + 1);
+    if (l_size < size / 8 || r_size < size / 8) {
+      if (--bad_allowed == 0) {
+        std::make_heap(begin, end, comp);
+        std::sort_heap(begin, end, comp);
+        return;
+      }
+      BreakPatterns(begin, pivot_pos, end);
+    } else if (already_partitioned &&
+               PartialInsertionSort(begin, pivot_pos, comp) &&
+               PartialInsertionSort(pivot_pos + 1, end, comp)) {
+      // Диапазон был почти упорядочен
+      return;
+    }
+
+    // Рекурсия в левую часть, цикл по правой
+    PdqSortLoop(begin, pivot_pos, comp, bad_allowed, leftmost);
+    begin = pivot_pos + 1;
+    leftmost = false;
+  }
+}
+
+// Беззнаковый ключ с тем же порядком, что и у value
+template <typename T>
+auto RadixKey(T value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    using Key = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    Key bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    constexpr Key kSign = Key{1} << (sizeof(Key) * 8 - 1);
+    return (bits & kSign) ? static_cast<Key>(~bits) : (bits | kSign);
+  } else if constexpr (std::is_signed_v<T>) {
+    using Key = std::make_unsigned_t<T>;
+    constexpr Key kSign = Key{1} << (sizeof(Key) * 8 - 1);
+    return static_cast<Key>(static_cast<Key>(value) ^ kSign);
+  } else {
+    return value;
+  }
+}
+
+/*
+ * Чем шире цифра, тем меньше проходов, но гистограмма 8-битной цифры
+ * помещается в L1, а 16-битной — уже нет. По замерам 16-битные цифры
+ * окупаются примерно с 4 млн элементов, 8-битные выгоднее до 64 тыс.
+ */
+template <typename T>
+unsigned DigitBits(RadixDigit digit, size_t size) {
+  if (digit != RadixDigit::kAuto) return static_cast<unsigned>(digit);
+  if (sizeof(T) == 1 || size < (size_t{1} << 16)) return 8;
+  if (size >= (size_t{1} << 22)) return 16;
+  return 11;
+}
+
+/*
+ * Устойчиво сортирует src[0, size) по младшим key_bits битам ключа
+ * цифрами по bits бит, dst — буфер того же размера. Возвращает src или
+ * dst, смотря где после чётного или нечётного числа проходов оказался
+ * результат.
+ */
+template <typename T>
+T *LsdRadixPasses(T *src, T *dst, size_t size, unsigned key_bits,
+                  unsigned bits, std::vector<size_t> &counts) {
+  unsigned passes = (key_bits + bits - 1) / bits;
+  size_t buckets = size_t{1} << bits;
+  size_t mask = buckets - 1;
+
+  // Гистограммы всех цифр за один проход
+  counts.assign(passes * buckets, 0);
+  for (const T *it = src; it != src + size; ++it) {
+    auto key = RadixKey(*it);
+    for (unsigned pass = 0; pass < passes; ++pass) {
+      ++counts[pass * buckets + (static_cast<size_t>(key >> (pass * bits)) &
+                                 mask)];
+    }
+  }
+
+  for (unsigned pass = 0; pass < passes; ++pass) {
+    size_t *count = counts.data() + pass * buckets;
+    unsigned shift = pass * bits;
+    auto digit_of = [shift, mask](T value) {
+      return static_cast<size_t>(RadixKey(value) >> shift) & mask;
+    };
+    // Все ключи с одной цифрой: проход ничего не меняет
+    if (count[digit_of(*src)] == size) continue;
+    size_t offset = 0;
+    for (size_t bucket = 0; bucket < buckets; ++bucket) {
+      size_t bucket_size = count[bucket];
+      count[bucket] = offset;
+      offset += bucket_size;
+    }
+    for (const T *it = src; it != src + size; ++it) {
+      dst[count[digit_of(*it)]++] = *it;
+    }
+    std::swap(src, dst);
+  }
+  return src;
+}
+
+// С этого размера RadixSort начинает с раскладки по старшей цифре
+inline constexpr size_t kMsdRadixThreshold = size_t{1} << 22;
+// Примерный размер корзины после неё: должна помещаться в L2
+inline constexpr size_t kMsdBucketElements = size_t{1} << 15;
+// Корзины не длиннее этого досортировываются вставками
+inline constexpr size_t kSmallBucketElements = 64;
+inline constexpr unsigned kBucketDigitBits = 11;
+
+/*
+ * На больших массивах каждый LSD-проход читает и пишет весь массив в
+ * памяти. Вместо этого один устойчивый проход раскладывает элементы по
+ * старшей цифре в buffer, а затем каждая корзина, которая помещается в
+ * кэш, досортировывается LSD по оставшимся битам обратно в first.
+ * Возвращает false, ничего не меняя, если все ключи попали в одну корзину.
+ */
+template <typename T>
+bool MsdRadixPass(T *first, T *buffer, size_t size) {
+  constexpr unsigned kKeyBits = sizeof(T) * 8;
+  unsigned msd_bits = 8;
+  while (msd_bits < 16 && (size >> msd_bits) > kMsdBucketElements) {
+    ++msd_bits;
+  }
+  unsigned shift = kKeyBits - msd_bits;
+  auto digit_of = [shift](T value) {
+    return static_cast<size_t>(RadixKey(value) >> shift);
+  };
+
+  std::vector<size_t> starts((size_t{1} << msd_bits) + 1);
+  for (const T *it = first; it != first + size; ++it) {
+    ++starts[digit_of(*it) + 1];
+  }
+  if (*std::max_element(starts.begin(), starts.end()) == size) return false;
+  for (size_t bucket = 1; bucket < starts.size(); ++bucket) {
+    starts[bucket] += starts[bucket - 1];
+  }
+  std::vector<size_t> positions(starts.begin(), starts.end() - 1);
+  for (const T *it = first; it != first + size; ++it) {
+    buffer[positions[digit_of(*it)]++] = *it;
+  }
+
+  auto key_less = [](const T &a, const T &b) {
+    return RadixKey(a) < RadixKey(b);
+  };
+  std::vector<size_t> counts;
+  for (size_t bucket = 0; bucket + 1 < starts.size(); ++bucket) {
+    size_t length = starts[bucket + 1] - starts[bucket];
+    T *part = buffer + starts[bucket];
+    T *out = first + starts[bucket];
+    if (length <= kSmallBucketElements) {
+      std::copy(part, part + length, out);
+      InsertionSort(out, out + length, key_less);
+      continue;
+    }
+    T *result =
+        LsdRadixPasses(part, out, length, shift, kBucketDigitBits, counts);
+    if (result != out) std::copy(result, result + length, out);
+  }
+  return true;
+}
+
+}  // namespace sort_detail
+
+template <typename RandomIt, typename Compare>
+void PdqSort(RandomIt first, RandomIt last, Compare comp) {
+  ptrdiff_t size = last - first;
+  if (size < 2) return;
+  int bad_allowed = 0;
+  for (ptrdiff_t n = size; n > 1; n >>= 1) {
+    ++bad_allowed;
+  }
+  sort_detail::PdqSortLoop(first, last, comp, bad_allowed, true);
+}
+
+template <typename T>
+void RadixSort(T *first, T *last, RadixDigit digit) {
+  static_assert(kRadixSortable<T>,
+                "RadixSort supports integral types, float and double");
+  size_t size = static_cast<size_t>(last - first);
+  if (size < 2) return;
+  std::unique_ptr<T[]> buffer(new T[size]);
+  if (digit == RadixDigit::kAuto && sizeof(T) >= 4 &&
+      size >= sort_detail::kMsdRadixThreshold &&
+      sort_detail::MsdRadixPass(first, buffer.get(), size)) {
+    return;
+  }
+  std::vector<size_t> counts;
+  T *result = sort_detail::LsdRadixPasses(
+      first, buffer.get(), size, sizeof(T) * 8,
+      sort_detail::DigitBits<T>(digit, size), counts);
+  if (result != first) std::copy(result, result + size, first);
+}
+
+template <typename RandomIt, typename Compare>
+void Sort(RandomIt first, RandomIt last, Compare comp) {
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  constexpr bool kAscending = std::is_same_v<Compare, std::less<>> ||
+                              std::is_same_v<Compare, std::less<T>>;
+  if constexpr (std::is_pointer_v<RandomIt> && kRadixSortable<T> &&
+                kAscending) {
+    if (static_cast<size_t>(last - first) >= kRadixSortThreshold) {
+      RadixSort(first, last);
+      return;
+    }
+  }
+  PdqSort(first, last, comp);
+}
+
+}  // namespace s21
+
+#endif  // SRC_SORT_S21_SORT_TPP_
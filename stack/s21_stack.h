@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 
 namespace s21 {
 template <typename T>
@@ -79,11 +80,17 @@ class Stack {
 
   size_type Size() const { return size_; }
 
-  void Push(const_reference value) {
-    Node* newNode = new Node(value);
+  void Push(const_reference value) { Emplace(value); }
+
+  void Push(value_type&& value) { Emplace(std::move(value)); }
+
+  template <typename... Args>
+  reference Emplace(Args&&... args) {
+    Node* newNode = new Node(std::in_place, std::forward<Args>(args)...);
     newNode->next = head_;
     head_ = newNode;
     ++size_;
+    return newNode->data;
   }
 
   void Pop() {
@@ -115,6 +122,9 @@ class Stack {
     Node* next;       // указатель на след элемент
     Node(const_reference value)
         : data(value), next(nullptr) {}  // конструктор класса Node
+    template <typename... Args>
+    Node(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...), next(nullptr) {}
   };
 
   Node* head_;      // верхний элемент
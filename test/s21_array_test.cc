@@ -178,3 +178,23 @@ TEST(ArrayTest, fill) {
     EXPECT_EQ(my[i], orig[i]);
   }
 }
+
+TEST(ArrayTest, copyAndMoveStrings) {
+  s21::Array<std::string, 3> first = {"a", "b", "c"};
+  s21::Array<std::string, 3> second(first);
+  EXPECT_EQ(second[2], "c");
+  s21::Array<std::string, 3> third(std::move(first));
+  EXPECT_EQ(third[0], "a");
+  second = {"x", "y", "z"};
+  third = second;
+  EXPECT_EQ(third[1], "y");
+}
+
+TEST(ArrayTest, alignedStorage) {
+  s21::Array<float, 10, 64> arr = {1.0f, 2.0f};
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(arr.Data()) % 64, 0u);
+  EXPECT_EQ(alignof(decltype(arr)), 64u);
+  s21::Array<float, 10, 64> copy(arr);
+  EXPECT_EQ(copy[1], 2.0f);
+  EXPECT_EQ(copy.Size(), 10u);
+}
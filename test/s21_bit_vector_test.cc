@@ -0,0 +1,163 @@
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../bit_vector/s21_bit_vector.h"
+#include "test.h"
+
+namespace {
+
+uint64_t NextRandom(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+// Случайные биты с вероятностью единицы 1 / every
+s21::BitVector MakeRandom(size_t size, uint64_t seed, uint64_t every) {
+  s21::BitVector bits(size);
+  for (size_t i = 0; i < size; ++i) {
+    if (NextRandom(seed) % every == 0) bits.Set(i);
+  }
+  return bits;
+}
+
+}  // namespace
+
+TEST(BitVectorTest, setTestAndResize) {
+  s21::BitVector bits(130);
+  EXPECT_EQ(bits.Size(), 130u);
+  EXPECT_EQ(bits.WordCount(), 3u);
+  EXPECT_TRUE(bits.None());
+  bits.Set(0);
+  bits[64] = true;
+  bits[129] = bits[0];
+  bits.Flip(1);
+  bits.Reset(0);
+  EXPECT_FALSE(bits[0]);
+  EXPECT_TRUE(bits.At(1));
+  EXPECT_TRUE(bits.Test(64));
+  EXPECT_TRUE(bits[129]);
+  EXPECT_THROW(bits.At(130), std::out_of_range);
+  bits.Resize(200, true);
+  EXPECT_EQ(bits.Count(), 3u + 70u);
+  bits.Resize(65);
+  EXPECT_EQ(bits.Count(), 2u);
+  EXPECT_EQ(bits.WordCount(), 2u);
+  bits.Resize(128);
+  EXPECT_FALSE(bits[100]);
+}
+
+TEST(BitVectorTest, pushPopAndInitializerList) {
+  s21::BitVector bits = {true, false, true, true};
+  EXPECT_EQ(bits.Size(), 4u);
+  EXPECT_EQ(bits.Count(), 3u);
+  for (int i = 0; i < 100; ++i) {
+    bits.PushBack(i % 3 == 0);
+  }
+  EXPECT_EQ(bits.Size(), 104u);
+  EXPECT_EQ(bits.Count(), 3u + 34u);
+  while (bits.Size() > 2) {
+    bits.PopBack();
+  }
+  EXPECT_EQ(bits.WordCount(), 1u);
+  EXPECT_EQ(bits.Count(), 1u);
+  bits.Clear();
+  EXPECT_TRUE(bits.Empty());
+  EXPECT_THROW(bits.PopBack(), std::out_of_range);
+}
+
+TEST(BitVectorTest, countAndWholeVectorOperations) {
+  s21::BitVector bits(1000, true);
+  EXPECT_EQ(bits.Count(), 1000u);
+  // Хвост последнего слова остаётся нулевым
+  EXPECT_EQ(bits.Data()[15], (uint64_t{1} << 40) - 1);
+  bits.FlipAll();
+  EXPECT_TRUE(bits.None());
+  bits.SetAll();
+  bits.ResetAll();
+  EXPECT_FALSE(bits.Any());
+  s21::BitVector random = MakeRandom(777, 5, 3);
+  size_t expected = 0;
+  for (size_t i = 0; i < random.Size(); ++i) {
+    expected += random[i];
+  }
+  EXPECT_EQ(random.Count(), expected);
+  EXPECT_EQ((~random).Count(), 777u - expected);
+}
+
+TEST(BitVectorTest, bulkLogic) {
+  s21::BitVector a = MakeRandom(300, 1, 2);
+  s21::BitVector b = MakeRandom(300, 2, 2);
+  s21::BitVector both = a & b;
+  s21::BitVector either = a | b;
+  s21::BitVector one = a ^ b;
+  for (size_t i = 0; i < 300; ++i) {
+    EXPECT_EQ(both[i], a[i] && b[i]);
+    EXPECT_EQ(either[i], a[i] || b[i]);
+    EXPECT_EQ(one[i], a[i] != b[i]);
+  }
+  EXPECT_EQ((a ^ a).Count(), 0u);
+  EXPECT_EQ(a | ~a, s21::BitVector(300, true));
+  EXPECT_NE(a, b);
+  s21::BitVector shorter(299);
+  EXPECT_THROW(a &= shorter, std::invalid_argument);
+}
+
+TEST(BitVectorTest, findFirstAndNext) {
+  s21::BitVector bits(500);
+  EXPECT_EQ(bits.FindFirst(), s21::BitVector::kNpos);
+  std::vector<size_t> positions = {3, 63, 64, 200, 499};
+  for (size_t pos : positions) {
+    bits.Set(pos);
+  }
+  std::vector<size_t> found;
+  for (size_t pos = bits.FindFirst(); pos != s21::BitVector::kNpos;
+       pos = bits.FindNext(pos)) {
+    found.push_back(pos);
+  }
+  EXPECT_EQ(found, positions);
+  EXPECT_EQ(bits.FindNext(499), s21::BitVector::kNpos);
+  EXPECT_EQ(bits.FindNext(1000), s21::BitVector::kNpos);
+}
+
+TEST(BitVectorTest, rankAndSelectMatchScan) {
+  // Плотный, разреженный и почти пустой наборы
+  for (uint64_t every : {2, 37, 5000}) {
+    s21::BitVector bits = MakeRandom(70000, every, every);
+    std::vector<size_t> ones;
+    for (size_t i = 0; i < bits.Size(); ++i) {
+      if (bits[i]) ones.push_back(i);
+    }
+    for (int indexed = 0; indexed < 2; ++indexed) {
+      if (indexed) bits.BuildRankIndex();
+      EXPECT_EQ(bits.HasRankIndex(), indexed == 1);
+      size_t rank = 0;
+      for (size_t pos = 0; pos <= bits.Size(); pos += 61) {
+        while (rank < ones.size() && ones[rank] < pos) ++rank;
+        EXPECT_EQ(bits.Rank(pos), rank);
+      }
+      EXPECT_EQ(bits.Rank(bits.Size()), ones.size());
+      for (size_t k = 0; k < ones.size(); k += 7) {
+        EXPECT_EQ(bits.Select(k), ones[k]);
+      }
+      EXPECT_EQ(bits.Select(ones.size()), s21::BitVector::kNpos);
+    }
+    EXPECT_THROW(bits.Rank(bits.Size() + 1), std::out_of_range);
+  }
+}
+
+TEST(BitVectorTest, changesDropRankIndex) {
+  s21::BitVector bits(1024, true);
+  bits.BuildRankIndex();
+  EXPECT_EQ(bits.Rank(512), 512u);
+  bits[0] = false;
+  EXPECT_FALSE(bits.HasRankIndex());
+  EXPECT_EQ(bits.Rank(512), 511u);
+  EXPECT_EQ(bits.Select(0), 1u);
+  s21::BitVector other;
+  other.Swap(bits);
+  EXPECT_EQ(other.Count(), 1023u);
+  EXPECT_TRUE(bits.Empty());
+}
@@ -0,0 +1,161 @@
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+
+#include "test.h"
+
+TEST(CompactSetTest, DefaultConstructor) {
+  s21::CompactSet<int> set;
+  EXPECT_TRUE(set.Empty());
+  EXPECT_EQ(set.Size(), 0U);
+  EXPECT_TRUE(set.Begin() == set.End());
+}
+
+TEST(CompactSetTest, InsertAndContains) {
+  s21::CompactSet<int> set = {5, 1, 3, 3};
+  EXPECT_EQ(set.Size(), 3U);
+  EXPECT_TRUE(set.Contains(1));
+  EXPECT_TRUE(set.Contains(3));
+  EXPECT_TRUE(set.Contains(5));
+  EXPECT_FALSE(set.Contains(2));
+}
+
+TEST(CompactSetTest, InsertReturnsIterator) {
+  s21::CompactSet<int> set;
+  auto first = set.Insert(10);
+  EXPECT_TRUE(first.second);
+  EXPECT_EQ(*first.first, 10);
+  auto second = set.Insert(10);
+  EXPECT_FALSE(second.second);
+  EXPECT_EQ(*second.first, 10);
+}
+
+TEST(CompactSetTest, InsertIteratorWalksWholeSet) {
+  s21::CompactSet<int> set;
+  std::set<int> orig;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 3000; ++i) {
+    int key = static_cast<int>(gen() % 1000);
+    orig.insert(key);
+    auto it = set.Insert(key).first;
+    ASSERT_EQ(*it, key);
+    // Итератор вставки должен продолжать обход как итератор Find
+    auto expected = orig.upper_bound(key);
+    ++it;
+    if (expected == orig.end()) {
+      EXPECT_TRUE(it == set.End());
+    } else {
+      EXPECT_EQ(*it, *expected);
+    }
+  }
+}
+
+TEST(CompactSetTest, EraseReleasesKey) {
+  struct Key {
+    std::shared_ptr<int> value;
+    bool operator<(const Key& other) const {
+      return *value < *other.value;
+    }
+  };
+  auto value = std::make_shared<int>(1);
+  s21::CompactSet<Key> set;
+  set.Insert(Key{value});
+  set.Insert(Key{std::make_shared<int>(2)});
+  EXPECT_EQ(value.use_count(), 2);
+  set.Erase(Key{std::make_shared<int>(1)});
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(CompactSetTest, IterationIsSorted) {
+  s21::CompactSet<int> set;
+  for (int i = 100; i > 0; --i) {
+    set.Insert((i * 37) % 101);
+  }
+  int previous = -1;
+  size_t count = 0;
+  for (auto it = set.Begin(); it != set.End(); ++it) {
+    EXPECT_LT(previous, *it);
+    previous = *it;
+    ++count;
+  }
+  EXPECT_EQ(count, set.Size());
+}
+
+TEST(CompactSetTest, DecrementFromEnd) {
+  s21::CompactSet<int> set = {1, 2, 3, 4};
+  auto it = set.End();
+  --it;
+  EXPECT_EQ(*it, 4);
+  --it;
+  --it;
+  --it;
+  EXPECT_EQ(*it, 1);
+  EXPECT_TRUE(it == set.Begin());
+}
+
+TEST(CompactSetTest, FindAndContinue) {
+  s21::CompactSet<int> set = {10, 20, 30, 40, 50};
+  auto it = set.Find(30);
+  ASSERT_TRUE(it != set.End());
+  ++it;
+  EXPECT_EQ(*it, 40);
+  EXPECT_TRUE(set.Find(35) == set.End());
+}
+
+TEST(CompactSetTest, EraseReusesSlots) {
+  s21::CompactSet<int> set;
+  for (int i = 0; i < 64; ++i) set.Insert(i);
+  size_t capacity = set.Capacity();
+  for (int i = 0; i < 64; i += 2) EXPECT_EQ(set.Erase(i), 1U);
+  EXPECT_EQ(set.Erase(0), 0U);
+  EXPECT_EQ(set.Size(), 32U);
+  for (int i = 100; i < 132; ++i) set.Insert(i);
+  EXPECT_EQ(set.Capacity(), capacity);
+  EXPECT_EQ(set.Size(), 64U);
+}
+
+TEST(CompactSetTest, RandomAgainstStdSet) {
+  s21::CompactSet<std::uint32_t> set;
+  std::set<std::uint32_t> orig;
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<std::uint32_t> dist(0, 2000);
+  for (int i = 0; i < 20000; ++i) {
+    std::uint32_t key = dist(gen);
+    if (gen() % 3 == 0) {
+      EXPECT_EQ(set.Erase(key), orig.erase(key));
+    } else {
+      EXPECT_EQ(set.Insert(key).second, orig.insert(key).second);
+    }
+  }
+  ASSERT_EQ(set.Size(), orig.size());
+  auto it = set.Begin();
+  for (auto key : orig) {
+    EXPECT_EQ(*it, key);
+    ++it;
+  }
+  EXPECT_TRUE(it == set.End());
+}
+
+TEST(CompactSetTest, CopyAndMove) {
+  s21::CompactSet<int> set = {1, 2, 3};
+  s21::CompactSet<int> copy = set;
+  copy.Insert(4);
+  EXPECT_EQ(set.Size(), 3U);
+  EXPECT_EQ(copy.Size(), 4U);
+
+  s21::CompactSet<int> moved = std::move(copy);
+  EXPECT_EQ(moved.Size(), 4U);
+  EXPECT_TRUE(moved.Contains(4));
+  EXPECT_TRUE(copy.Empty());
+  EXPECT_TRUE(copy.Begin() == copy.End());
+}
+
+TEST(CompactSetTest, Clear) {
+  s21::CompactSet<int> set = {1, 2, 3};
+  set.Clear();
+  EXPECT_TRUE(set.Empty());
+  EXPECT_FALSE(set.Contains(2));
+  set.Insert(7);
+  EXPECT_EQ(*set.Begin(), 7);
+}
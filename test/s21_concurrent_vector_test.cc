@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../concurrent_vector/s21_concurrent_vector.h"
+#include "../thread_pool/s21_thread_pool.h"
+#include "test.h"
+
+namespace {
+
+struct ThrowsOnSeven {
+  explicit ThrowsOnSeven(int v) : value(v) {
+    if (v == 7) throw std::runtime_error("seven");
+  }
+  int value;
+};
+
+}  // namespace
+
+TEST(ConcurrentVectorTest, pushBackKeepsAddresses) {
+  s21::ConcurrentVector<std::string> v;
+  EXPECT_TRUE(v.Empty());
+  std::vector<const std::string *> addresses;
+  for (int i = 0; i < 10000; ++i) {
+    EXPECT_EQ(v.PushBack(std::to_string(i)), static_cast<size_t>(i));
+    addresses.push_back(&v[i]);
+  }
+  EXPECT_EQ(v.Size(), 10000u);
+  for (int i = 0; i < 10000; ++i) {
+    ASSERT_EQ(&v[i], addresses[i]);
+    ASSERT_EQ(v.At(i), std::to_string(i));
+  }
+  EXPECT_THROW(v.At(10000), std::out_of_range);
+  EXPECT_FALSE(v.IsPublished(10000));
+}
+
+TEST(ConcurrentVectorTest, growByCrossesChunks) {
+  s21::ConcurrentVector<int> v;
+  EXPECT_EQ(v.GrowBy(10, 1), 0u);
+  EXPECT_EQ(v.GrowBy(1000, 2), 10u);
+  EXPECT_EQ(v.EmplaceBack(3), 1010u);
+  EXPECT_EQ(v.GrowBy(0), 1011u);
+  EXPECT_EQ(v.Size(), 1011u);
+  for (size_t i = 0; i < v.Size(); ++i) {
+    int expected = i < 10 ? 1 : i < 1010 ? 2 : 3;
+    ASSERT_TRUE(v.IsPublished(i));
+    ASSERT_EQ(v[i], expected);
+  }
+}
+
+TEST(ConcurrentVectorTest, concurrentPushBack) {
+  constexpr int kThreads = 8;
+  constexpr int kPerThread = 20000;
+  s21::ConcurrentVector<int> v;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&v, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        size_t pos = i % 3 == 0 ? v.GrowBy(1, t * kPerThread + i)
+                                : v.PushBack(t * kPerThread + i);
+        // Свой элемент можно читать сразу
+        ASSERT_EQ(v[pos], t * kPerThread + i);
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  ASSERT_EQ(v.Size(), static_cast<size_t>(kThreads * kPerThread));
+  s21::Vector<int> frozen = v.Freeze();
+  EXPECT_TRUE(v.Empty());
+  ASSERT_EQ(frozen.Size(), static_cast<size_t>(kThreads * kPerThread));
+  std::sort(frozen.Data(), frozen.Data() + frozen.Size());
+  for (int i = 0; i < kThreads * kPerThread; ++i) {
+    ASSERT_EQ(frozen.Data()[i], i);
+  }
+}
+
+TEST(ConcurrentVectorTest, readersSeePublishedElements) {
+  s21::ConcurrentVector<std::string> v;
+  std::atomic<bool> done{false};
+  std::atomic<size_t> broken{0};
+  std::thread reader([&] {
+    while (!done.load()) {
+      size_t size = v.Size();
+      for (size_t i = 0; i < size; ++i) {
+        if (v.IsPublished(i) && v[i].rfind("item ", 0) != 0) {
+          broken.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    }
+  });
+  s21::ThreadPool pool(2);
+  pool.ParallelFor(5000, [&v](size_t i) {
+    v.GrowBy(1, "item " + std::to_string(i % 100));
+  });
+  done = true;
+  reader.join();
+  EXPECT_EQ(v.Size(), 5000u);
+  // Порядок вставки в пуле не задан, проверяем только состав
+  size_t per_value = 0;
+  for (size_t i = 0; i < v.Size(); ++i) {
+    if (v.At(i) == "item 42") ++per_value;
+  }
+  EXPECT_EQ(per_value, 50u);
+  EXPECT_EQ(broken.load(), 0u);
+}
+
+TEST(ConcurrentVectorTest, failedConstructionLeavesHole) {
+  s21::ConcurrentVector<ThrowsOnSeven> v;
+  for (int i = 0; i < 10; ++i) {
+    if (i == 7) {
+      EXPECT_THROW(v.EmplaceBack(i), std::runtime_error);
+    } else {
+      v.EmplaceBack(i);
+    }
+  }
+  EXPECT_EQ(v.Size(), 10u);
+  EXPECT_FALSE(v.IsPublished(7));
+  EXPECT_THROW(v.At(7), std::out_of_range);
+  s21::Vector<ThrowsOnSeven> frozen = v.Freeze();
+  ASSERT_EQ(frozen.Size(), 9u);
+  EXPECT_EQ(frozen.Data()[7].value, 8);
+}
+
+TEST(ConcurrentVectorTest, reserveAndClear) {
+  s21::ConcurrentVector<double> v;
+  v.Reserve(100000);
+  EXPECT_TRUE(v.Empty());
+  v.GrowBy(100000, 0.5);
+  EXPECT_EQ(v[99999], 0.5);
+  v.Clear();
+  EXPECT_EQ(v.Size(), 0u);
+  EXPECT_EQ(v.PushBack(1.5), 0u);
+  EXPECT_THROW(v.Reserve(v.MaxSize() + 1), std::length_error);
+}
@@ -0,0 +1,163 @@
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../deque/s21_deque.h"
+#include "test.h"
+
+namespace {
+
+template <typename T>
+std::vector<T> ToStd(const s21::Deque<T> &d) {
+  return std::vector<T>(d.Begin(), d.End());
+}
+
+}  // namespace
+
+TEST(DequeTest, pushAndPopAtBothEnds) {
+  s21::Deque<int> d;
+  EXPECT_TRUE(d.Empty());
+  std::deque<int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    if (i % 3 == 0) {
+      d.PushFront(i);
+      expected.push_front(i);
+    } else {
+      d.PushBack(i);
+      expected.push_back(i);
+    }
+  }
+  ASSERT_EQ(d.Size(), expected.size());
+  EXPECT_EQ(ToStd(d), std::vector<int>(expected.begin(), expected.end()));
+  EXPECT_EQ(d.Front(), expected.front());
+  EXPECT_EQ(d.Back(), expected.back());
+  for (int i = 0; i < 1000; ++i) {
+    d.PopFront();
+    expected.pop_front();
+    d.PopBack();
+    expected.pop_back();
+  }
+  EXPECT_EQ(ToStd(d), std::vector<int>(expected.begin(), expected.end()));
+  while (!d.Empty()) d.PopBack();
+  EXPECT_EQ(d.Size(), 0u);
+  EXPECT_EQ(d.Begin(), d.End());
+}
+
+TEST(DequeTest, referencesStayValid) {
+  s21::Deque<std::string> d;
+  std::string &middle = d.EmplaceBack("middle");
+  std::vector<const std::string *> pointers;
+  for (int i = 0; i < 5000; ++i) {
+    pointers.push_back(&d.EmplaceFront(std::to_string(i)));
+    d.PushBack(std::to_string(-i));
+  }
+  EXPECT_EQ(middle, "middle");
+  EXPECT_EQ(&d[5000], &middle);
+  for (int i = 0; i < 5000; ++i) {
+    EXPECT_EQ(*pointers[i], std::to_string(i));
+  }
+  for (int i = 0; i < 4000; ++i) d.PopFront();
+  EXPECT_EQ(*pointers[500], "500");
+  EXPECT_EQ(middle, "middle");
+}
+
+TEST(DequeTest, randomAccessIterators) {
+  s21::Deque<int> d;
+  for (int i = 0; i < 1000; ++i) d.PushFront(i);
+  std::sort(d.Begin(), d.End());
+  for (int i = 0; i < 1000; ++i) ASSERT_EQ(d[i], i);
+  s21::Deque<int>::iterator it = d.Begin() + 700;
+  EXPECT_EQ(*it, 700);
+  EXPECT_EQ(it[-500], 200);
+  EXPECT_EQ(*(it - 699), 1);
+  EXPECT_EQ(d.End() - it, 300);
+  EXPECT_TRUE(d.Begin() < it && it < d.End());
+  s21::Deque<int>::constIterator cit = it;
+  EXPECT_EQ(*--cit, 699);
+  EXPECT_EQ(std::lower_bound(d.Begin(), d.End(), 321) - d.Begin(), 321);
+  std::reverse(d.Begin(), d.End());
+  EXPECT_EQ(d.Front(), 999);
+  EXPECT_EQ(d.At(999), 0);
+}
+
+TEST(DequeTest, forEachBlockVisitsInOrder) {
+  s21::Deque<double> d;
+  for (int i = 1; i <= 2000; ++i) d.PushBack(i);
+  for (int i = 0; i < 123; ++i) d.PopFront();
+  std::vector<double> visited;
+  size_t blocks = 0;
+  const s21::Deque<double> &view = d;
+  view.ForEachBlock([&](const double *first, const double *last) {
+    ASSERT_LE(last - first,
+              static_cast<std::ptrdiff_t>(s21::Deque<double>::kBlockSize));
+    visited.insert(visited.end(), first, last);
+    ++blocks;
+  });
+  EXPECT_EQ(visited, ToStd(d));
+  EXPECT_GT(blocks, 1u);
+  d.ForEachBlock([](double *first, double *last) {
+    for (; first != last; ++first) *first *= 2;
+  });
+  EXPECT_EQ(d.Front(), 248.0);
+  EXPECT_EQ(d.Back(), 4000.0);
+}
+
+TEST(DequeTest, slidingQueueReusesMap) {
+  s21::Deque<int> d;
+  long long sum = 0;
+  for (int i = 0; i < 200000; ++i) {
+    d.PushBack(i);
+    if (d.Size() > 100) {
+      sum += d.Front();
+      d.PopFront();
+    }
+  }
+  EXPECT_EQ(d.Size(), 100u);
+  EXPECT_EQ(d.Front(), 199900);
+  EXPECT_EQ(sum, 199899LL * 199900 / 2);
+  for (int i = 0; i < 200000; ++i) {
+    d.PushFront(i);
+    d.PopBack();
+  }
+  EXPECT_EQ(d.Back(), 199900);
+  d.Clear();
+  EXPECT_TRUE(d.Empty());
+  d.PushFront(7);
+  EXPECT_EQ(d.Back(), 7);
+}
+
+TEST(DequeTest, copyMoveAndSwap) {
+  s21::Deque<std::string> a = {"a", "b", "c"};
+  for (int i = 0; i < 500; ++i) a.PushFront(std::to_string(i));
+  s21::Deque<std::string> b(a);
+  EXPECT_EQ(ToStd(b), ToStd(a));
+  s21::Deque<std::string> c(std::move(a));
+  EXPECT_TRUE(a.Empty());
+  EXPECT_EQ(ToStd(c), ToStd(b));
+  a = c;
+  EXPECT_EQ(ToStd(a), ToStd(c));
+  s21::Deque<std::string> d(3);
+  EXPECT_EQ(d.Size(), 3u);
+  EXPECT_EQ(d[2], "");
+  d = std::move(c);
+  EXPECT_EQ(d.Back(), "c");
+  d.Swap(c);
+  EXPECT_EQ(c.Size(), 503u);
+  EXPECT_TRUE(d.Empty());
+  d.ShrinkToFit();
+  EXPECT_GT(d.MaxSize(), 0u);
+}
+
+TEST(DequeTest, reportsEmptyAndRange) {
+  s21::Deque<int> d;
+  EXPECT_THROW(d.Front(), std::out_of_range);
+  EXPECT_THROW(d.Back(), std::out_of_range);
+  EXPECT_THROW(d.PopBack(), std::out_of_range);
+  EXPECT_THROW(d.PopFront(), std::out_of_range);
+  d.PushBack(1);
+  EXPECT_THROW(d.At(1), std::out_of_range);
+  EXPECT_EQ(d.At(0), 1);
+}
@@ -0,0 +1,164 @@
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "../sort/s21_external_sort.h"
+#include "test.h"
+
+namespace {
+
+uint64_t NextRandom(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+std::string TempPath(const std::string &name) {
+  return testing::TempDir() + "s21_external_" + name + "_" +
+         std::to_string(getpid());
+}
+
+template <typename T>
+void WriteFile(const std::string &path, const std::vector<T> &values) {
+  std::FILE *file = std::fopen(path.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+  if (!values.empty()) {
+    std::fwrite(values.data(), sizeof(T), values.size(), file);
+  }
+  std::fclose(file);
+}
+
+template <typename T>
+std::vector<T> ReadFile(const std::string &path) {
+  std::vector<T> values;
+  std::FILE *file = std::fopen(path.c_str(), "rb");
+  if (!file) return values;
+  T value;
+  while (std::fread(&value, sizeof(T), 1, file) == 1) {
+    values.push_back(value);
+  }
+  std::fclose(file);
+  return values;
+}
+
+// Бюджет, при котором 300000 ключей дают 14 серий и три прохода слияния по 3
+s21::ExternalSortOptions SmallBudget() {
+  s21::ExternalSortOptions options;
+  options.memory_bytes = 8 * s21::kMinExternalBlockBytes;
+  options.temp_dir = testing::TempDir();
+  return options;
+}
+
+struct Record {
+  uint32_t key;
+  uint32_t order;
+};
+
+}  // namespace
+
+TEST(ExternalSortTest, sortsAcrossManyRuns) {
+  std::string input = TempPath("input");
+  std::string output = TempPath("output");
+  std::vector<uint64_t> values(300000);
+  uint64_t state = 17;
+  for (uint64_t &value : values) {
+    value = NextRandom(state) % 1000000;
+  }
+  WriteFile(input, values);
+  s21::ExternalSortStats stats =
+      s21::ExternalSort<uint64_t>(input, output, SmallBudget());
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(ReadFile<uint64_t>(output), values);
+  EXPECT_EQ(stats.elements, values.size());
+  EXPECT_EQ(stats.runs, 14u);
+  EXPECT_EQ(stats.merge_passes, 3u);
+  std::remove(input.c_str());
+  std::remove(output.c_str());
+}
+
+TEST(ExternalSortTest, comparatorAndPool) {
+  std::string path = TempPath("in_place");
+  std::vector<Record> records(100000);
+  uint64_t state = 5;
+  for (uint32_t i = 0; i < records.size(); ++i) {
+    records[i] = {static_cast<uint32_t>(NextRandom(state) % 5000), i};
+  }
+  WriteFile(path, records);
+  s21::ThreadPool pool(2);
+  s21::ExternalSortOptions options = SmallBudget();
+  options.pool = &pool;
+  auto by_key_descending = [](const Record &a, const Record &b) {
+    return a.key > b.key;
+  };
+  // Вход и выход — один и тот же файл
+  s21::ExternalSort<Record>(path, path, options, by_key_descending);
+  std::vector<Record> sorted = ReadFile<Record>(path);
+  ASSERT_EQ(sorted.size(), records.size());
+  EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end(), by_key_descending));
+  uint64_t orders = 0;
+  for (const Record &record : sorted) {
+    orders += record.order;
+  }
+  EXPECT_EQ(orders, uint64_t{99999} * 100000 / 2);
+  std::remove(path.c_str());
+}
+
+TEST(ExternalSortTest, smallAndEmptyInputs) {
+  std::string input = TempPath("small");
+  std::string output = TempPath("small_out");
+  WriteFile(input, std::vector<int32_t>{5, -1, 3});
+  s21::ExternalSortStats stats = s21::ExternalSort<int32_t>(input, output);
+  EXPECT_EQ(ReadFile<int32_t>(output), (std::vector<int32_t>{-1, 3, 5}));
+  EXPECT_EQ(stats.runs, 1u);
+  EXPECT_EQ(stats.merge_passes, 0u);
+  WriteFile(input, std::vector<int32_t>{});
+  stats = s21::ExternalSort<int32_t>(input, output, SmallBudget());
+  EXPECT_EQ(stats.elements, 0u);
+  EXPECT_EQ(stats.runs, 0u);
+  EXPECT_TRUE(ReadFile<int32_t>(output).empty());
+  std::remove(input.c_str());
+  std::remove(output.c_str());
+}
+
+TEST(ExternalSortTest, reportsErrors) {
+  s21::ExternalSortOptions options;
+  options.memory_bytes = 1024;
+  EXPECT_THROW(s21::ExternalSort<int>("a", "b", options),
+               std::invalid_argument);
+  EXPECT_THROW(s21::ExternalSort<int>(TempPath("missing"), TempPath("out")),
+               std::system_error);
+  std::string odd = TempPath("odd");
+  WriteFile(odd, std::vector<char>{1, 2, 3});
+  EXPECT_THROW(s21::ExternalSort<int>(odd, TempPath("out")),
+               std::runtime_error);
+  std::remove(odd.c_str());
+}
+
+TEST(ExternalSortTest, loserTreeMergesSources) {
+  struct Source {
+    std::vector<int> values;
+    size_t pos = 0;
+    bool Done() const { return pos == values.size(); }
+    const int &Front() const { return values[pos]; }
+  };
+  std::vector<Source> sources = {
+      {{1, 4, 9}}, {{}}, {{2, 3, 10, 11}}, {{0}}, {{4, 5}}};
+  s21::external_sort_detail::LoserTree<Source, std::less<>> tree(sources, {});
+  std::vector<int> merged;
+  while (!tree.Empty()) {
+    size_t winner = tree.Winner();
+    merged.push_back(sources[winner].Front());
+    ++sources[winner].pos;
+    tree.Replay(winner);
+  }
+  EXPECT_EQ(merged, (std::vector<int>{0, 1, 2, 3, 4, 4, 5, 9, 10, 11}));
+}
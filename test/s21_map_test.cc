@@ -1,3 +1,8 @@
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <string>
+
 #include "test.h"
 
 TEST(MapTest, GetKey1) {
@@ -582,3 +587,345 @@ TEST(MapTest, InitializerListConstructor) {
   EXPECT_EQ(map.At(2), "two");
   EXPECT_EQ(map.At(3), "three");
 }
+
+TEST(MapTest, CompactKeepsContents) {
+  s21::Map<int, std::string> map;
+  for (int i = 0; i < 50; ++i) {
+    map.Insert({(i * 17) % 50, std::to_string(i)});
+  }
+  map.Erase(3);
+  map.Erase(40);
+  map.Compact();
+
+  EXPECT_EQ(map.Size(), 48);
+  int previous = -1;
+  for (auto it = map.Begin(); it != map.End(); ++it) {
+    EXPECT_LT(previous, *it);
+    previous = *it;
+  }
+  EXPECT_FALSE(map.Contains(3));
+  EXPECT_EQ(map.At(17), "1");
+}
+
+TEST(MapTest, CompactPlacesNodesContiguously) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 32; ++i) {
+    map.Insert({(i * 7) % 32, i});
+  }
+  map.Compact();
+
+  const s21::Map<int, int>::Node* first = map.Begin().operator->();
+  const s21::Map<int, int>::Node* last = first;
+  for (auto it = map.Begin(); it != map.End(); ++it) {
+    const s21::Map<int, int>::Node* node = it.operator->();
+    if (node < first) first = node;
+    if (node > last) last = node;
+  }
+  EXPECT_EQ(static_cast<size_t>(last - first), map.Size() - 1);
+}
+
+TEST(MapTest, CompactThenModify) {
+  s21::Map<int, int> map = {{5, 5}, {3, 3}, {8, 8}, {1, 1}};
+  map.Compact();
+  map.Insert({4, 4});
+  map.Erase(3);
+  map.Erase(5);
+  map[9] = 9;
+  map.Compact();
+  map.Erase(1);
+
+  std::list<int> keys;
+  for (auto it = map.Begin(); it != map.End(); ++it) keys.push_back(*it);
+  EXPECT_EQ(keys, (std::list<int>{4, 8, 9}));
+
+  s21::Map<int, int> copy = map;
+  s21::Map<int, int> moved = std::move(map);
+  moved.Clear();
+  EXPECT_EQ(copy.Size(), 3);
+  EXPECT_EQ(copy.At(9), 9);
+}
+
+TEST(MapTest, CopyDegenerateTree) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 10000; ++i) {
+    map.Insert({i, i * 2});
+  }
+  s21::Map<int, int> copy = map;
+  EXPECT_EQ(copy.Size(), map.Size());
+  int expected = 0;
+  for (auto it = copy.Begin(); it != copy.End(); ++it, ++expected) {
+    EXPECT_EQ(*it, expected);
+  }
+  EXPECT_EQ(expected, 10000);
+  copy.Erase(5000);
+  EXPECT_TRUE(map.Contains(5000));
+  map.Clear();
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(copy.At(9999), 19998);
+}
+
+TEST(MapTest, CopyLargeTree) {
+  s21::Map<int, int> map;
+  std::mt19937 gen(21);
+  for (int i = 0; i < 100000; ++i) {
+    int key = static_cast<int>(gen() % 1000000);
+    map[key] = i;
+  }
+  s21::Map<int, int> copy;
+  copy = map;
+  ASSERT_EQ(copy.Size(), map.Size());
+  auto original = map.Begin();
+  for (auto it = copy.Begin(); it != copy.End(); ++it, ++original) {
+    EXPECT_EQ(*it, *original);
+    EXPECT_EQ(it->value, original->value);
+  }
+  --original;
+  EXPECT_EQ(*original, *(--copy.End()));
+}
+
+namespace {
+
+// Копия бросает исключение, когда обратный отсчёт доходит до нуля
+struct CopyBomb {
+  static std::atomic<long> countdown;
+
+  CopyBomb() = default;
+  explicit CopyBomb(int value) : payload(64, static_cast<char>('a' + value)) {}
+  CopyBomb(const CopyBomb& other) : payload(other.payload) {
+    if (--countdown == 0) throw std::runtime_error("copy");
+  }
+  CopyBomb(CopyBomb&&) = default;
+  CopyBomb& operator=(const CopyBomb&) = default;
+
+  std::string payload;
+};
+
+std::atomic<long> CopyBomb::countdown{0};
+
+// Перемещение и копия бросают исключение, как только отсчёт доходит до нуля
+struct MoveBomb {
+  static long countdown;
+
+  explicit MoveBomb(int value) : payload(64, static_cast<char>('a' + value)) {}
+  MoveBomb(const MoveBomb& other) : payload(other.payload) { Tick(); }
+  MoveBomb(MoveBomb&& other) : payload(std::move(other.payload)) { Tick(); }
+  MoveBomb& operator=(const MoveBomb&) = default;
+
+  void Tick() {
+    if (--countdown == 0) throw std::runtime_error("move");
+  }
+
+  std::string payload;
+};
+
+long MoveBomb::countdown = 0;
+
+}  // namespace
+
+TEST(MapTest, CopyThrowingValueLeavesNothingBehind) {
+  using BombMap = s21::Map<int, CopyBomb>;
+  for (int size : {100, 200000}) {
+    BombMap map;
+    for (int i = 0; i < size; ++i) map.Insert({i, CopyBomb(i % 26)});
+    for (long fail : {1L, size / 3L, static_cast<long>(size)}) {
+      CopyBomb::countdown = fail;
+      EXPECT_THROW(BombMap{map}, std::runtime_error);
+      BombMap target = {{-1, CopyBomb(0)}};
+      CopyBomb::countdown = fail;
+      EXPECT_THROW(target = map, std::runtime_error);
+      EXPECT_TRUE(target.Empty());
+    }
+    CopyBomb::countdown = 0;
+    BombMap copy(map);
+    EXPECT_EQ(copy.Size(), map.Size());
+  }
+}
+
+TEST(MapTest, CompactWithThrowingMoveKeepsTree) {
+  s21::Map<int, MoveBomb> map;
+  for (int i = 0; i < 1000; ++i) map.Insert({i, MoveBomb(i % 26)});
+  for (long fail : {1L, 500L, 1000L}) {
+    MoveBomb::countdown = fail;
+    EXPECT_THROW(map.Compact(), std::runtime_error);
+    MoveBomb::countdown = 0;
+    ASSERT_EQ(map.Size(), 1000U);
+    for (int i = 0; i < 1000; ++i) {
+      ASSERT_EQ(map.At(i).payload, MoveBomb(i % 26).payload);
+    }
+  }
+  map.Compact();
+  map.Erase(0);
+  EXPECT_EQ(map.At(999).payload, MoveBomb(999 % 26).payload);
+  EXPECT_EQ(map.Size(), 999U);
+}
+
+TEST(MapTest, SplitRangesAreBalanced) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map.Insert({(i * 379) % 1000, i});
+  }
+  auto ranges = map.SplitRanges(4);
+  ASSERT_EQ(ranges.size(), 4U);
+  EXPECT_TRUE(ranges.front().first == map.Begin());
+  EXPECT_TRUE(ranges.back().second == map.End());
+  int expected = 0;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    if (i > 0) {
+      EXPECT_TRUE(ranges[i].first == ranges[i - 1].second);
+    }
+    size_t count = 0;
+    for (auto it = ranges[i].first; it != ranges[i].second; ++it, ++count) {
+      EXPECT_EQ(*it, expected++);
+    }
+    EXPECT_EQ(count, 250U);
+  }
+}
+
+TEST(MapTest, SplitRangesMorePartsThanElements) {
+  s21::Map<int, int> map = {{1, 1}, {2, 2}};
+  EXPECT_EQ(map.SplitRanges(8).size(), 2U);
+  map.Clear();
+  EXPECT_TRUE(map.SplitRanges(8).empty());
+}
+
+TEST(MapTest, SubtreeSizesAfterErase) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 200; ++i) {
+    map.Insert({(i * 37) % 200, i});
+  }
+  for (int i = 0; i < 200; i += 3) {
+    map.Erase(i);
+  }
+  auto ranges = map.SplitRanges(133);
+  ASSERT_EQ(ranges.size(), 133U);
+  for (auto &range : ranges) {
+    auto next = range.first;
+    ++next;
+    EXPECT_TRUE(next == range.second);
+  }
+}
+
+TEST(MapTest, ParallelForEach) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 10000; ++i) {
+    map.Insert({(i * 7919) % 10000, 0});
+  }
+  map.ParallelForEach([](const int &key, int &value) { value = key * 2; },
+                      4);
+  for (auto it = map.Begin(); it != map.End(); ++it) {
+    EXPECT_EQ(it->value, *it * 2);
+  }
+}
+
+TEST(MapTest, ParallelForEachRethrows) {
+  s21::Map<int, int> map = {{1, 1}, {2, 2}, {3, 3}};
+  EXPECT_THROW(map.ParallelForEach(
+                   [](const int &key, int &) {
+                     if (key == 2) throw std::runtime_error("fail");
+                   },
+                   3),
+               std::runtime_error);
+}
+
+TEST(MapTest, SplitAndJoin) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map.Insert({i, i * 10});
+  }
+  auto parts = map.Split(400);
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(parts.first.Size(), 400);
+  EXPECT_EQ(parts.second.Size(), 600);
+  EXPECT_EQ(*parts.first.Begin(), 0);
+  EXPECT_EQ(*(--parts.first.End()), 399);
+  EXPECT_EQ(*parts.second.Begin(), 400);
+  EXPECT_EQ(parts.second.At(999), 9990);
+
+  parts.first.Erase(10);
+  parts.second.Insert({1000, 10000});
+  s21::Map<int, int> joined =
+      s21::Map<int, int>::Join(std::move(parts.first), std::move(parts.second));
+  EXPECT_TRUE(parts.first.Empty());
+  EXPECT_TRUE(parts.second.Empty());
+  EXPECT_EQ(joined.Size(), 1000);
+  int expected = 0;
+  for (auto it = joined.Begin(); it != joined.End(); ++it) {
+    if (expected == 10) ++expected;
+    EXPECT_EQ(*it, expected++);
+  }
+  EXPECT_EQ(joined.SplitRanges(1000).size(), 1000U);
+}
+
+TEST(MapTest, SplitCompactedTree) {
+  s21::Map<int, std::string> map;
+  for (int i = 0; i < 100; ++i) {
+    map.Insert({i, std::to_string(i)});
+  }
+  map.Compact();
+  auto parts = map.Split(50);
+  parts.first.Clear();
+  EXPECT_EQ(parts.second.At(75), "75");
+  parts.second.Erase(60);
+  s21::Map<int, std::string> other = {{-1, "minus"}};
+  using StringMap = s21::Map<int, std::string>;
+  StringMap joined = StringMap::Join(std::move(other), std::move(parts.second));
+  EXPECT_EQ(joined.Size(), 50);
+  EXPECT_EQ(joined.At(-1), "minus");
+  joined.Compact();
+  EXPECT_EQ(joined.At(99), "99");
+}
+
+TEST(MapTest, RepeatedSplitJoinOfCompactedTree) {
+  using StringMap = s21::Map<int, std::string>;
+  StringMap map;
+  for (int i = 0; i < 1000; ++i) map.Insert({i, std::to_string(i)});
+  map.Compact();
+  for (int round = 0; round < 200; ++round) {
+    auto parts = map.Split((round * 37) % 1000);
+    map = StringMap::Join(std::move(parts.first), std::move(parts.second));
+  }
+  EXPECT_EQ(map.Size(), 1000);
+  // Каждый узел блока удаляется по отдельности, последний освобождает блок
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(map.At(i), std::to_string(i));
+    EXPECT_EQ(map.Erase(i), 1U);
+  }
+  EXPECT_TRUE(map.Empty());
+}
+
+TEST(MapTest, SplitPartsOfOneBlockOutliveEachOther) {
+  s21::Map<int, std::string> map;
+  for (int i = 0; i < 100; ++i) map.Insert({i, std::to_string(i)});
+  map.Compact();
+  s21::Map<int, std::string> copy = map;
+  auto parts = copy.Split(50);
+  {
+    auto moved = std::move(parts.first);
+    moved.Erase(10);
+  }
+  EXPECT_EQ(parts.second.At(99), "99");
+  parts.second.Compact();
+  EXPECT_EQ(parts.second.Size(), 50);
+  EXPECT_EQ(map.At(10), "10");
+}
+
+TEST(MapTest, JoinRejectsOverlappingKeys) {
+  s21::Map<int, int> left = {{1, 1}, {5, 5}};
+  s21::Map<int, int> right = {{5, 5}, {9, 9}};
+  using IntMap = s21::Map<int, int>;
+  EXPECT_THROW(IntMap::Join(std::move(left), std::move(right)),
+               std::invalid_argument);
+  EXPECT_EQ(left.Size(), 2);
+  EXPECT_EQ(right.Size(), 2);
+}
+
+TEST(MapTest, SortedInsertStaysShallow) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 200000; ++i) {
+    map.Insert({i, i});
+  }
+  EXPECT_EQ(map.Size(), 200000);
+  auto parts = map.Split(100000);
+  EXPECT_EQ(parts.first.Size(), 100000);
+  EXPECT_EQ(parts.second.Size(), 100000);
+}
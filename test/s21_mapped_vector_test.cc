@@ -0,0 +1,189 @@
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "../mapped_vector/s21_mapped_vector.h"
+#include "test.h"
+
+namespace {
+
+struct Point {
+  int32_t x;
+  int32_t y;
+  double weight;
+};
+
+// Путь к временному файлу, который удаляется в конце теста
+class TempFile {
+ public:
+  explicit TempFile(const std::string &name)
+      : path_(testing::TempDir() + "s21_mapped_" + name + "_" +
+              std::to_string(getpid())) {
+    std::remove(path_.c_str());
+  }
+  ~TempFile() { std::remove(path_.c_str()); }
+  const std::string &Path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+}  // namespace
+
+TEST(MappedVectorTest, pushAndAccess) {
+  TempFile file("push");
+  s21::MappedVector<Point> points(file.Path());
+  EXPECT_TRUE(points.Empty());
+  EXPECT_EQ(points.Capacity(), 0u);
+  points.PushBack({1, 2, 0.5});
+  Point &added = points.EmplaceBack(Point{3, 4, 1.5});
+  added.weight = 2.5;
+  EXPECT_EQ(points.Size(), 2u);
+  EXPECT_EQ(points[1].weight, 2.5);
+  EXPECT_EQ(points.At(0).y, 2);
+  EXPECT_EQ(points.Back().x, 3);
+  EXPECT_THROW(points.At(2), std::out_of_range);
+  points.PopBack();
+  EXPECT_EQ(points.Front().x, points.Back().x);
+  points.Clear();
+  EXPECT_THROW(points.PopBack(), std::out_of_range);
+}
+
+TEST(MappedVectorTest, growsThroughRemap) {
+  TempFile file("grow");
+  s21::MappedVector<uint64_t> values(file.Path());
+  for (uint64_t i = 0; i < 100000; ++i) {
+    values.PushBack(i * i);
+  }
+  EXPECT_GE(values.Capacity(), values.Size());
+  uint64_t sum = 0;
+  for (auto it = values.Begin(); it != values.End(); ++it) {
+    sum += *it;
+  }
+  EXPECT_EQ(sum, 333328333350000ULL);
+  // Значение из самого вектора в момент переотображения
+  values.ShrinkToFit();
+  EXPECT_EQ(values.Capacity(), values.Size());
+  values.PushBack(values[0]);
+  EXPECT_EQ(values.Back(), 0u);
+  values.Reserve(1 << 20);
+  EXPECT_EQ(values.Capacity(), 1u << 20);
+  EXPECT_THROW(values.Reserve(values.MaxSize() + 1), std::length_error);
+}
+
+TEST(MappedVectorTest, survivesReopen) {
+  TempFile file("reopen");
+  {
+    s21::MappedVector<Point> points(file.Path());
+    for (int i = 0; i < 1000; ++i) {
+      points.PushBack({i, -i, i * 0.25});
+    }
+    points.Sync();
+    points.Advise(s21::MapAdvice::kSequential);
+  }
+  s21::MappedVector<Point> reopened(file.Path());
+  ASSERT_EQ(reopened.Size(), 1000u);
+  EXPECT_EQ(reopened[999].y, -999);
+  reopened.PushBack({7, 7, 7.0});
+  EXPECT_EQ(reopened.Size(), 1001u);
+}
+
+TEST(MappedVectorTest, readOnlyMapping) {
+  TempFile file("read_only");
+  {
+    s21::MappedVector<int32_t> values(file.Path());
+    for (int32_t i = 0; i < 5000; ++i) {
+      values.PushBack(i);
+    }
+  }
+  s21::ConstMappedVector<int32_t> values(file.Path());
+  EXPECT_EQ(values.Size(), 5000u);
+  EXPECT_EQ(values[4321], 4321);
+  EXPECT_EQ(values.At(7), 7);
+  EXPECT_EQ(values.Data()[10], 10);
+  EXPECT_EQ(values.Back(), 4999);
+  EXPECT_EQ(values.End() - values.Begin(), 5000);
+  EXPECT_THROW(values.At(5000), std::out_of_range);
+  values.Advise(s21::MapAdvice::kRandom);
+  // Вектор только для чтения не пишет заголовок и не меняет файл
+  s21::ConstMappedVector<int32_t> moved(std::move(values));
+  EXPECT_EQ(moved.Front(), 0);
+  {
+    s21::ConstMappedVector<int32_t> again(file.Path());
+    EXPECT_EQ(again.Size(), 5000u);
+  }
+  s21::MappedVector<int32_t> writable(file.Path());
+  EXPECT_EQ(writable.Size(), 5000u);
+}
+
+TEST(MappedVectorTest, insertAndErase) {
+  TempFile file("insert");
+  s21::MappedVector<int32_t> values(file.Path());
+  for (int32_t i = 0; i < 4; ++i) {
+    values.PushBack(i);
+  }
+  values.ShrinkToFit();
+  // Вставка с ростом, значение из самого вектора
+  auto it = values.Insert(values.Begin() + 1, values[3]);
+  EXPECT_EQ(*it, 3);
+  it = values.Insert(values.End(), 9);
+  EXPECT_EQ(it, values.End() - 1);
+  int32_t expected[] = {0, 3, 1, 2, 3, 9};
+  ASSERT_EQ(values.Size(), 6u);
+  for (size_t i = 0; i < values.Size(); ++i) {
+    EXPECT_EQ(values[i], expected[i]);
+  }
+  it = values.Erase(values.Begin() + 1);
+  EXPECT_EQ(*it, 1);
+  it = values.Erase(values.Begin(), values.Begin() + 2);
+  EXPECT_EQ(*it, 2);
+  ASSERT_EQ(values.Size(), 3u);
+  values.Front() = 5;
+  values.Back() += 1;
+  EXPECT_EQ(values[0], 5);
+  EXPECT_EQ(values[1], 3);
+  EXPECT_EQ(values[2], 10);
+  EXPECT_EQ(values.Erase(values.End(), values.End()), values.End());
+}
+
+TEST(MappedVectorTest, rejectsForeignFiles) {
+  TempFile file("foreign");
+  EXPECT_THROW(s21::ConstMappedVector<int>(file.Path()), std::system_error);
+  {
+    s21::MappedVector<int32_t> values(file.Path());
+    values.PushBack(1);
+  }
+  // Другой размер элемента
+  EXPECT_THROW(s21::MappedVector<int64_t>(file.Path()), std::runtime_error);
+  {
+    std::ofstream text(file.Path(), std::ios::trunc);
+    text << "plain text, not a vector\n";
+    for (int i = 0; i < 10; ++i) {
+      text << "line " << i << '\n';
+    }
+  }
+  EXPECT_THROW(s21::MappedVector<int32_t>(file.Path()), std::runtime_error);
+}
+
+TEST(MappedVectorTest, moveAndSwap) {
+  TempFile first_file("first");
+  TempFile second_file("second");
+  s21::MappedVector<int> first(first_file.Path());
+  s21::MappedVector<int> second(second_file.Path());
+  first.PushBack(1);
+  second.PushBack(2);
+  second.PushBack(3);
+  first.Swap(second);
+  EXPECT_EQ(first.Size(), 2u);
+  EXPECT_EQ(second[0], 1);
+  s21::MappedVector<int> moved = std::move(first);
+  EXPECT_EQ(moved[1], 3);
+  moved = std::move(second);
+  EXPECT_EQ(moved.Size(), 1u);
+}
@@ -1,3 +1,5 @@
+#include <atomic>
+
 #include "test.h"
 
 TEST(MultiSetTest, InsertAndContains1) {
@@ -222,3 +224,60 @@ TEST(MultiSetTest, InitializerListConstructor) {
   EXPECT_EQ(multiSet.Count(20), 1);
   EXPECT_EQ(multiSet.Count(30), 1);
 }
+
+TEST(MultiSetTest, CompactKeepsDuplicates) {
+  s21::MultiSet<int> multiSet = {5, 1, 5, 3, 5};
+  multiSet.Compact();
+  EXPECT_EQ(multiSet.Size(), 5);
+  EXPECT_EQ(multiSet.Count(5), 3);
+  multiSet.Erase(5);
+  EXPECT_EQ(multiSet.Size(), 2);
+  EXPECT_FALSE(multiSet.Contains(5));
+}
+
+TEST(MultiSetTest, ParallelForEachVisitsDuplicates) {
+  s21::MultiSet<int> multiSet = {4, 4, 1, 4, 2};
+  std::atomic<int> fours{0};
+  multiSet.ParallelForEach(
+      [&fours](const int& key) {
+        if (key == 4) ++fours;
+      },
+      2);
+  EXPECT_EQ(fours.load(), 3);
+}
+
+TEST(MultiSetTest, InsertRvalueString) {
+  s21::MultiSet<std::string> multiSet;
+  std::string a = "b";
+  multiSet.Insert(std::string("a"));
+  multiSet.Insert(std::move(a));
+  multiSet.Insert(std::string("c"));
+  std::list<std::string> keys;
+  for (auto it = multiSet.Begin(); it != multiSet.End(); ++it) {
+    keys.push_back(*it);
+  }
+  EXPECT_EQ(keys, (std::list<std::string>{"a", "b", "c"}));
+}
+
+TEST(MultiSetTest, CountManyDuplicates) {
+  s21::MultiSet<int> multiSet;
+  for (int i = 0; i < 300; ++i) {
+    multiSet.Insert(i % 3);
+  }
+  EXPECT_EQ(multiSet.Count(0), 100);
+  EXPECT_EQ(multiSet.Count(1), 100);
+  EXPECT_EQ(multiSet.Count(2), 100);
+  EXPECT_EQ(multiSet.Count(3), 0);
+}
+
+TEST(MultiSetTest, SplitAndJoinWithEqualKeys) {
+  s21::MultiSet<int> multiSet = {1, 2, 2, 2, 3};
+  auto parts = multiSet.Split(2);
+  EXPECT_EQ(parts.first.Size(), 1);
+  EXPECT_EQ(parts.second.Count(2), 3);
+  s21::MultiSet<int> tail = {0, 0, 1};
+  s21::MultiSet<int> joined =
+      s21::MultiSet<int>::Join(std::move(tail), std::move(parts.first));
+  EXPECT_EQ(joined.Size(), 4);
+  EXPECT_EQ(joined.Count(1), 2);
+}
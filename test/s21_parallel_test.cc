@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "../parallel/s21_parallel.h"
+#include "test.h"
+
+namespace {
+
+// Достаточно элементов, чтобы алгоритмы разбили работу на несколько задач
+constexpr size_t kSize = 200003;
+
+s21::Vector<uint32_t> MakeKeys(size_t size) {
+  s21::Vector<uint32_t> keys(size);
+  uint32_t state = 12345;
+  for (size_t i = 0; i < size; ++i) {
+    state = state * 1103515245U + 12345U;
+    keys[i] = state >> 8;
+  }
+  return keys;
+}
+
+}  // namespace
+
+TEST(ParallelTest, sortMatchesStdSort) {
+  s21::ThreadPool pool(4);
+  s21::Vector<uint32_t> keys = MakeKeys(kSize);
+  std::vector<uint32_t> expected(keys.Begin(), keys.End());
+  std::sort(expected.begin(), expected.end());
+  s21::parallel::Sort(pool, keys.Begin(), keys.End());
+  EXPECT_TRUE(std::equal(keys.Begin(), keys.End(), expected.begin()));
+  s21::parallel::Sort(pool, keys.Begin(), keys.End(), std::greater<>());
+  EXPECT_TRUE(std::is_sorted(keys.Begin(), keys.End(), std::greater<>()));
+}
+
+TEST(ParallelTest, sortShortRange) {
+  s21::ThreadPool pool(2);
+  std::vector<int> values = {5, 3, 9, 1};
+  s21::parallel::Sort(pool, values.begin(), values.end());
+  EXPECT_EQ(values, (std::vector<int>{1, 3, 5, 9}));
+  s21::parallel::Sort(pool, values.begin(), values.begin());
+}
+
+TEST(ParallelTest, stableSortKeepsOrderOfEqualKeys) {
+  s21::ThreadPool pool(3);
+  s21::Vector<uint32_t> keys = MakeKeys(kSize);
+  s21::Vector<std::pair<uint32_t, size_t>> items(kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    items[i] = {keys[i] % 100, i};
+  }
+  s21::parallel::StableSort(
+      pool, items.Begin(), items.End(),
+      [](const auto &a, const auto &b) { return a.first < b.first; });
+  EXPECT_TRUE(std::is_sorted(items.Begin(), items.End()));
+}
+
+TEST(ParallelTest, transformAndForEach) {
+  s21::ThreadPool pool(4);
+  s21::Vector<uint32_t> keys = MakeKeys(kSize);
+  s21::Vector<uint64_t> doubled(kSize);
+  auto end = s21::parallel::Transform(
+      pool, keys.Begin(), keys.End(), doubled.Begin(),
+      [](uint32_t key) { return uint64_t{key} * 2; });
+  EXPECT_EQ(end, doubled.End());
+  for (size_t i = 0; i < kSize; ++i) {
+    ASSERT_EQ(doubled[i], uint64_t{keys[i]} * 2);
+  }
+  s21::parallel::ForEach(pool, doubled.Begin(), doubled.End(),
+                         [](uint64_t &value) { value /= 2; });
+  EXPECT_TRUE(std::equal(keys.Begin(), keys.End(), doubled.Begin()));
+}
+
+TEST(ParallelTest, reduceMatchesAccumulate) {
+  s21::ThreadPool pool(4);
+  s21::Vector<uint32_t> keys = MakeKeys(kSize);
+  EXPECT_EQ(s21::parallel::Reduce(pool, keys.Begin(), keys.End(), uint64_t{7}),
+            std::accumulate(keys.Begin(), keys.End(), uint64_t{7}));
+  EXPECT_EQ(s21::parallel::Reduce(pool, keys.Begin(), keys.Begin(), 42), 42);
+  uint32_t max = s21::parallel::Reduce(
+      pool, keys.Begin(), keys.End(), uint32_t{0},
+      [](uint32_t a, uint32_t b) { return std::max(a, b); });
+  EXPECT_EQ(max, *std::max_element(keys.Begin(), keys.End()));
+}
+
+TEST(ParallelTest, reduceIsDeterministic) {
+  s21::Vector<float> values(kSize);
+  for (size_t i = 0; i < kSize; ++i) {
+    values[i] = 1.0f / static_cast<float>(i + 1);
+  }
+  s21::ThreadPool one(1);
+  s21::ThreadPool four(4);
+  float expected =
+      s21::parallel::Reduce(one, values.Begin(), values.End(), 0.f);
+  for (int run = 0; run < 5; ++run) {
+    // Побитовое совпадение, а не приблизительное
+    EXPECT_EQ(s21::parallel::Reduce(four, values.Begin(), values.End(), 0.f),
+              expected);
+  }
+}
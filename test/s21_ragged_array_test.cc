@@ -0,0 +1,97 @@
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../ragged_array/s21_ragged_array.h"
+#include "test.h"
+
+namespace {
+
+template <typename T>
+std::vector<T> RowOf(const s21::RaggedArray<T> &array, size_t r) {
+  typename s21::RaggedArray<T>::constRowSpan row = array.Row(r);
+  return std::vector<T>(row.Begin(), row.End());
+}
+
+}  // namespace
+
+TEST(RaggedArrayTest, appendRowsAndSpans) {
+  s21::RaggedArray<int> array;
+  EXPECT_TRUE(array.Empty());
+  EXPECT_EQ(array.Rows(), 0u);
+  array.AppendRow({1, 2, 3});
+  array.AppendRow({});
+  std::vector<int> source = {4, 5};
+  array.AppendRow(source.begin(), source.end());
+  EXPECT_EQ(array.Rows(), 3u);
+  EXPECT_EQ(array.Size(), 5u);
+  EXPECT_EQ(RowOf(array, 0), (std::vector<int>{1, 2, 3}));
+  EXPECT_TRUE(array.Row(1).Empty());
+  EXPECT_EQ(array.RowSize(2), 2u);
+  EXPECT_EQ(array[2][1], 5);
+  EXPECT_EQ(array.Row(2).Data(), array.Begin() + 3);
+  const size_t *offsets = array.Offsets();
+  EXPECT_EQ((std::vector<size_t>(offsets, offsets + 4)),
+            (std::vector<size_t>{0, 3, 3, 5}));
+  EXPECT_THROW(array.Row(3), std::out_of_range);
+  EXPECT_THROW(array.Row(0).At(3), std::out_of_range);
+}
+
+TEST(RaggedArrayTest, buildRowByRow) {
+  s21::RaggedArray<std::string> array;
+  EXPECT_THROW(array.PushBack("orphan"), std::logic_error);
+  for (int r = 0; r < 100; ++r) {
+    array.AddRow();
+    for (int i = 0; i < r % 7; ++i) array.PushBack(std::to_string(r * i));
+  }
+  array.EmplaceBack(2, 'z');
+  EXPECT_EQ(array.Rows(), 100u);
+  for (int r = 0; r < 99; ++r) {
+    ASSERT_EQ(array.RowSize(r), static_cast<size_t>(r % 7));
+    for (int i = 0; i < r % 7; ++i) {
+      ASSERT_EQ(array[r][i], std::to_string(r * i));
+    }
+  }
+  EXPECT_EQ(RowOf(array, 99).back(), "zz");
+}
+
+TEST(RaggedArrayTest, freezeStopsAppends) {
+  s21::RaggedArray<int> array = {{1}, {2, 3}};
+  array.Freeze();
+  EXPECT_TRUE(array.IsFrozen());
+  EXPECT_THROW(array.AppendRow({4}), std::logic_error);
+  EXPECT_THROW(array.AddRow(), std::logic_error);
+  EXPECT_THROW(array.PushBack(4), std::logic_error);
+  EXPECT_THROW(array.Reserve(1, 1), std::logic_error);
+  // Значения менять можно
+  array[1][0] = 20;
+  EXPECT_EQ(RowOf(array, 1), (std::vector<int>{20, 3}));
+  array.Clear();
+  EXPECT_FALSE(array.IsFrozen());
+  EXPECT_TRUE(array.Empty());
+  array.AppendRow({7});
+  EXPECT_EQ(array[0][0], 7);
+}
+
+TEST(RaggedArrayTest, fromNestedVectorAndCopies) {
+  s21::Vector<s21::Vector<int>> nested = {{1, 2}, {}, {3}, {4, 5, 6}};
+  s21::RaggedArray<int> array(nested);
+  EXPECT_EQ(array.Rows(), 4u);
+  EXPECT_EQ(array.Size(), 6u);
+  int expected = 1;
+  for (const int *it = array.Begin(); it != array.End(); ++it) {
+    EXPECT_EQ(*it, expected++);
+  }
+  s21::RaggedArray<int> copy = array;
+  copy[0][0] = 100;
+  EXPECT_EQ(array[0][0], 1);
+  s21::RaggedArray<int> moved = std::move(copy);
+  EXPECT_EQ(moved[0][0], 100);
+  EXPECT_EQ(copy.Rows(), 0u);
+  copy.AppendRow({9});
+  EXPECT_EQ(copy.Rows(), 1u);
+  moved.Swap(copy);
+  EXPECT_EQ(moved[0][0], 9);
+  EXPECT_EQ(copy.Rows(), 4u);
+}
@@ -1,3 +1,5 @@
+#include <atomic>
+
 #include "test.h"
 
 TEST(SetTest, InsertAndContains1) {
@@ -298,3 +300,24 @@ TEST(SetTest, InsertRangeWithNewElements) {
   set.Insert(more_values.begin(), more_values.end());
   EXPECT_EQ(set.Size(), 6);
 }
+
+TEST(SetTest, ParallelForEach) {
+  s21::Set<int> set;
+  for (int i = 1; i <= 1000; ++i) set.Insert(i);
+  std::atomic<long> sum{0};
+  set.ParallelForEach([&sum](const int &key) { sum += key; }, 3);
+  EXPECT_EQ(sum.load(), 500500);
+}
+
+TEST(SetTest, SplitAndJoin) {
+  s21::Set<int> set = {1, 2, 3, 4, 5, 6};
+  auto parts = set.Split(4);
+  EXPECT_EQ(parts.first.Size(), 3);
+  EXPECT_EQ(parts.second.Size(), 3);
+  EXPECT_FALSE(parts.first.Contains(4));
+  EXPECT_TRUE(parts.second.Contains(4));
+  s21::Set<int> joined =
+      s21::Set<int>::Join(std::move(parts.second), s21::Set<int>{7, 8});
+  EXPECT_EQ(joined.Size(), 5);
+  EXPECT_EQ(*joined.Begin(), 4);
+}
@@ -0,0 +1,171 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "test.h"
+
+namespace {
+
+// Целые значения, чтобы суммы float/double были точными при любом порядке
+template <typename T>
+std::vector<T> MakeData(size_t size) {
+  std::vector<T> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<T>(static_cast<int>((i * 37 + 11) % 101) - 50);
+  }
+  return data;
+}
+
+template <typename T>
+void ExpectSameAsScalar(const std::vector<T>& data) {
+  const T* first = data.data();
+  const T* last = first + data.size();
+  std::vector<T> copy(data);
+  for (T value : {T(-50), T(0), T(17), T(1000)}) {
+    EXPECT_EQ(s21::simd::Find(first, last, value),
+              s21::simd::scalar::Find(first, last, value));
+    EXPECT_EQ(s21::simd::Count(first, last, value),
+              s21::simd::scalar::Count(first, last, value));
+#if S21_SIMD_X86
+    EXPECT_EQ(s21::simd::sse2::Find(first, last, value),
+              s21::simd::scalar::Find(first, last, value));
+    EXPECT_EQ(s21::simd::sse2::Count(first, last, value),
+              s21::simd::scalar::Count(first, last, value));
+    if (s21::simd::DetectedIsa() == s21::simd::Isa::kAvx2) {
+      EXPECT_EQ(s21::simd::avx2::Find(first, last, value),
+                s21::simd::scalar::Find(first, last, value));
+      EXPECT_EQ(s21::simd::avx2::Count(first, last, value),
+                s21::simd::scalar::Count(first, last, value));
+    }
+#endif
+  }
+  EXPECT_EQ(s21::simd::Sum(first, last), s21::simd::scalar::Sum(first, last));
+  EXPECT_TRUE(s21::simd::Equal(first, last, copy.data()));
+#if S21_SIMD_X86
+  EXPECT_EQ(s21::simd::sse2::Sum(first, last),
+            s21::simd::scalar::Sum(first, last));
+  if (s21::simd::DetectedIsa() == s21::simd::Isa::kAvx2) {
+    EXPECT_EQ(s21::simd::avx2::Sum(first, last),
+              s21::simd::scalar::Sum(first, last));
+  }
+#endif
+  if (!data.empty()) {
+    EXPECT_EQ(s21::simd::Min(first, last), s21::simd::scalar::Min(first, last));
+    EXPECT_EQ(s21::simd::Max(first, last), s21::simd::scalar::Max(first, last));
+#if S21_SIMD_X86
+    EXPECT_EQ(s21::simd::sse2::Min(first, last),
+              s21::simd::scalar::Min(first, last));
+    EXPECT_EQ(s21::simd::sse2::Max(first, last),
+              s21::simd::scalar::Max(first, last));
+    if (s21::simd::DetectedIsa() == s21::simd::Isa::kAvx2) {
+      EXPECT_EQ(s21::simd::avx2::Min(first, last),
+                s21::simd::scalar::Min(first, last));
+      EXPECT_EQ(s21::simd::avx2::Max(first, last),
+                s21::simd::scalar::Max(first, last));
+    }
+#endif
+    // Отличие в любой позиции, и в полном блоке, и в хвосте
+    for (size_t i = 0; i < copy.size(); ++i) {
+      copy[i] += T(1);
+      EXPECT_FALSE(s21::simd::Equal(first, last, copy.data()));
+#if S21_SIMD_X86
+      EXPECT_FALSE(s21::simd::sse2::Equal(first, last, copy.data()));
+#endif
+      copy[i] = data[i];
+    }
+  }
+}
+
+template <typename T>
+void ExpectFillMatchesScalar(size_t size) {
+  std::vector<T> expected(size + 2, T(-1));
+  s21::simd::scalar::Fill(expected.data() + 1, expected.data() + 1 + size,
+                          T(7));
+  std::vector<T> actual(size + 2, T(-1));
+  s21::simd::Fill(actual.data() + 1, actual.data() + 1 + size, 7);
+  EXPECT_EQ(actual, expected);
+#if S21_SIMD_X86
+  std::vector<T> sse2(size + 2, T(-1));
+  s21::simd::sse2::Fill(sse2.data() + 1, sse2.data() + 1 + size, T(7));
+  EXPECT_EQ(sse2, expected);
+  if (s21::simd::DetectedIsa() == s21::simd::Isa::kAvx2) {
+    std::vector<T> avx2(size + 2, T(-1));
+    s21::simd::avx2::Fill(avx2.data() + 1, avx2.data() + 1 + size, T(7));
+    EXPECT_EQ(avx2, expected);
+  }
+#endif
+}
+
+}  // namespace
+
+TEST(SimdTest, matchesScalarOnAllSizes) {
+  // Размеры с хвостами разной длины для регистров по 16 и 32 байта
+  for (size_t size = 0; size < 70; ++size) {
+    ExpectSameAsScalar(MakeData<int32_t>(size));
+    ExpectSameAsScalar(MakeData<float>(size));
+    ExpectSameAsScalar(MakeData<double>(size));
+    ExpectFillMatchesScalar<int32_t>(size);
+    ExpectFillMatchesScalar<float>(size);
+    ExpectFillMatchesScalar<double>(size);
+  }
+  ExpectSameAsScalar(MakeData<int32_t>(1000));
+  ExpectSameAsScalar(MakeData<double>(1001));
+}
+
+TEST(SimdTest, scalarFallbackTypes) {
+  std::vector<int64_t> longs = {5, -3, 9, 9, 0};
+  EXPECT_EQ(s21::simd::Max(longs.data(), longs.data() + longs.size()), 9);
+  EXPECT_EQ(s21::simd::Count(longs.data(), longs.data() + longs.size(), 9),
+            2U);
+  std::vector<uint8_t> bytes(300, 200);
+  EXPECT_EQ(s21::simd::Sum(bytes.data(), bytes.data() + bytes.size()),
+            60000U);
+}
+
+TEST(SimdTest, sumWidensInt32) {
+  std::vector<int32_t> data(100, INT32_MAX);
+  EXPECT_EQ(s21::simd::Sum(data.data(), data.data() + data.size()),
+            int64_t{INT32_MAX} * 100);
+}
+
+TEST(SimdTest, emptyRange) {
+  s21::Vector<float> vec;
+  EXPECT_THROW(s21::simd::Min(vec), std::out_of_range);
+  EXPECT_THROW(s21::simd::Max(vec), std::out_of_range);
+  EXPECT_EQ(s21::simd::Sum(vec), 0.0f);
+  EXPECT_EQ(s21::simd::Count(vec, 0.0f), 0U);
+  EXPECT_EQ(s21::simd::Find(vec, 0.0f), vec.End());
+  EXPECT_TRUE(s21::simd::Equal(vec, vec));
+}
+
+TEST(SimdTest, containerOverloads) {
+  s21::Vector<int32_t> vec = {4, 8, 15, 16, 23, 42, 4, 8, 15, 16, 23, 42};
+  EXPECT_EQ(s21::simd::Find(vec, 23), vec.Begin() + 4);
+  EXPECT_EQ(s21::simd::Find(vec, 5), vec.End());
+  EXPECT_EQ(s21::simd::Count(vec, 15), 2U);
+  EXPECT_EQ(s21::simd::Min(vec), 4);
+  EXPECT_EQ(s21::simd::Max(vec), 42);
+  EXPECT_EQ(s21::simd::Sum(vec), 216);
+  s21::Array<double, 9, 32> arr;
+  s21::simd::Fill(arr, 2.5);
+  EXPECT_EQ(s21::simd::Sum(arr), 22.5);
+  s21::Array<double, 9, 32> other = arr;
+  EXPECT_TRUE(s21::simd::Equal(arr, other));
+  other[8] = 0;
+  EXPECT_FALSE(s21::simd::Equal(arr, other));
+  s21::Vector<int32_t> shorter = {4, 8, 15};
+  EXPECT_FALSE(s21::simd::Equal(vec, shorter));
+}
+
+TEST(SimdTest, containerFill) {
+  s21::Vector<float> vec(37);
+  vec.Fill(1.5f);
+  EXPECT_EQ(vec.Size(), 37U);
+  EXPECT_EQ(s21::simd::Count(vec, 1.5f), 37U);
+  s21::Array<int32_t, 13> arr;
+  arr.Fill(-2);
+  EXPECT_EQ(s21::simd::Sum(arr), -26);
+  s21::Vector<std::string> strings(3);
+  strings.Fill("abc");
+  EXPECT_EQ(strings[2], "abc");
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../slot_map/s21_slot_map.h"
+#include "test.h"
+
+using Entities = s21::SlotMap<std::string>;
+
+TEST(SlotMapTest, insertFindErase) {
+  Entities map;
+  EXPECT_TRUE(map.Empty());
+  Entities::Handle a = map.Insert("alpha");
+  Entities::Handle b = map.Emplace(3, 'b');
+  std::string gamma = "gamma";
+  Entities::Handle c = map.Insert(gamma);
+  EXPECT_EQ(map.Size(), 3u);
+  EXPECT_EQ(map.At(a), "alpha");
+  EXPECT_EQ(map[b], "bbb");
+  EXPECT_EQ(*map.Find(c), "gamma");
+  EXPECT_TRUE(map.Erase(a));
+  EXPECT_FALSE(map.Erase(a));
+  EXPECT_FALSE(map.Contains(a));
+  EXPECT_EQ(map.Find(a), nullptr);
+  EXPECT_THROW(map.At(a), std::out_of_range);
+  // Остальные дескрипторы после переноса последнего значения верны
+  EXPECT_EQ(map.At(b), "bbb");
+  EXPECT_EQ(map.At(c), "gamma");
+  EXPECT_EQ(map.Size(), 2u);
+}
+
+TEST(SlotMapTest, reusedSlotRejectsStaleHandle) {
+  s21::SlotMap<int> map;
+  s21::SlotMap<int>::Handle old = map.Insert(1);
+  map.Erase(old);
+  s21::SlotMap<int>::Handle fresh = map.Insert(2);
+  EXPECT_EQ(fresh.index, old.index);
+  EXPECT_NE(fresh, old);
+  EXPECT_FALSE(map.Contains(old));
+  EXPECT_EQ(map.At(fresh), 2);
+  // Поддельный дескриптор свободной ячейки и дескриптор по умолчанию
+  map.Erase(fresh);
+  EXPECT_FALSE(map.Contains({old.index, fresh.generation + 1}));
+  EXPECT_FALSE(map.Contains(s21::SlotMap<int>::Handle{}));
+  EXPECT_FALSE(map.Contains({100, 1}));
+}
+
+TEST(SlotMapTest, denseStorageStaysContiguous) {
+  s21::SlotMap<int> map;
+  std::vector<s21::SlotMap<int>::Handle> handles;
+  for (int i = 0; i < 1000; ++i) handles.push_back(map.Insert(i));
+  for (int i = 0; i < 1000; i += 2) map.Erase(handles[i]);
+  ASSERT_EQ(map.Size(), 500u);
+  EXPECT_EQ(map.End() - map.Begin(), 500);
+  long long sum = 0;
+  for (const int *it = map.Begin(); it != map.End(); ++it) sum += *it;
+  EXPECT_EQ(sum, 250000);
+  for (int i = 1; i < 1000; i += 2) ASSERT_EQ(map.At(handles[i]), i);
+  for (size_t pos = 0; pos < map.Size(); ++pos) {
+    ASSERT_EQ(map.HandleAt(pos), handles[map.Data()[pos]]);
+  }
+  EXPECT_THROW(map.HandleAt(500), std::out_of_range);
+}
+
+TEST(SlotMapTest, randomOperationsMatchModel) {
+  s21::SlotMap<int> map;
+  std::vector<std::pair<s21::SlotMap<int>::Handle, int>> live;
+  std::vector<s21::SlotMap<int>::Handle> dead;
+  unsigned state = 7;
+  for (int step = 0; step < 20000; ++step) {
+    state = state * 1103515245 + 12345;
+    if (live.empty() || (state >> 16) % 3 != 0) {
+      live.push_back({map.Insert(step), step});
+    } else {
+      size_t victim = (state >> 8) % live.size();
+      ASSERT_TRUE(map.Erase(live[victim].first));
+      dead.push_back(live[victim].first);
+      live[victim] = live.back();
+      live.pop_back();
+    }
+  }
+  ASSERT_EQ(map.Size(), live.size());
+  for (const auto &[handle, value] : live) ASSERT_EQ(map.At(handle), value);
+  for (const auto &handle : dead) ASSERT_FALSE(map.Contains(handle));
+}
+
+TEST(SlotMapTest, clearAndSwap) {
+  Entities a;
+  Entities::Handle h = a.Insert("x");
+  a.Reserve(16);
+  Entities b;
+  b.Swap(a);
+  EXPECT_TRUE(a.Empty());
+  EXPECT_EQ(b.At(h), "x");
+  b.Clear();
+  EXPECT_TRUE(b.Empty());
+  EXPECT_FALSE(b.Contains(h));
+  Entities::Handle again = b.Insert("y");
+  EXPECT_EQ(again.index, h.index);
+  EXPECT_EQ(b.At(again), "y");
+  EXPECT_GT(b.MaxSize(), 0u);
+}
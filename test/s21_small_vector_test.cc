@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "test.h"
+
+TEST(SmallVectorTest, DefaultConstructor) {
+  s21::SmallVector<int, 4> vec;
+  EXPECT_TRUE(vec.Empty());
+  EXPECT_TRUE(vec.IsInline());
+  EXPECT_EQ(vec.Capacity(), 4U);
+}
+
+TEST(SmallVectorTest, StaysInlineUpToN) {
+  s21::SmallVector<int, 4> vec;
+  for (int i = 0; i < 4; ++i) {
+    vec.PushBack(i);
+  }
+  EXPECT_TRUE(vec.IsInline());
+  vec.PushBack(4);
+  EXPECT_FALSE(vec.IsInline());
+  EXPECT_GE(vec.Capacity(), 5U);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(vec[i], i);
+  }
+}
+
+TEST(SmallVectorTest, MatchesStdVector) {
+  s21::SmallVector<std::string, 3> vec = {"a", "b"};
+  std::vector<std::string> orig = {"a", "b"};
+  vec.Insert(vec.Begin(), "c");
+  orig.insert(orig.begin(), "c");
+  vec.EmplaceBack(2, 'd');
+  orig.emplace_back(2, 'd');
+  vec.InsertMany(vec.Begin() + 1, "e", "f");
+  orig.insert(orig.begin() + 1, {"e", "f"});
+  vec.Erase(vec.Begin() + 2);
+  orig.erase(orig.begin() + 2);
+  vec.EraseIf([](const std::string& s) { return s == "a"; });
+  orig.erase(std::remove(orig.begin(), orig.end(), "a"), orig.end());
+  ASSERT_EQ(vec.Size(), orig.size());
+  for (size_t i = 0; i < vec.Size(); ++i) {
+    EXPECT_EQ(vec.At(i), orig[i]);
+  }
+  EXPECT_THROW(vec.At(orig.size()), std::out_of_range);
+}
+
+TEST(SmallVectorTest, CopyAndMoveInline) {
+  s21::SmallVector<std::string, 4> vec = {"x", "y"};
+  s21::SmallVector<std::string, 4> copy(vec);
+  EXPECT_EQ(copy[1], "y");
+  s21::SmallVector<std::string, 4> moved(std::move(vec));
+  EXPECT_TRUE(moved.IsInline());
+  EXPECT_EQ(moved[0], "x");
+  EXPECT_TRUE(vec.Empty());
+  vec = moved;
+  EXPECT_EQ(vec.Size(), 2U);
+}
+
+TEST(SmallVectorTest, MoveHeapStealsBuffer) {
+  s21::SmallVector<int, 2> vec = {1, 2, 3, 4};
+  EXPECT_FALSE(vec.IsInline());
+  const int* data = vec.Data();
+  s21::SmallVector<int, 2> moved;
+  moved = std::move(vec);
+  EXPECT_EQ(moved.Data(), data);
+  EXPECT_TRUE(vec.IsInline());
+  EXPECT_TRUE(vec.Empty());
+}
+
+TEST(SmallVectorTest, SwapMixedStorage) {
+  s21::SmallVector<std::unique_ptr<int>, 2> small;
+  small.EmplaceBack(new int(1));
+  s21::SmallVector<std::unique_ptr<int>, 2> large;
+  for (int i = 0; i < 5; ++i) {
+    large.PushBack(std::make_unique<int>(i + 10));
+  }
+  small.Swap(large);
+  EXPECT_EQ(small.Size(), 5U);
+  EXPECT_EQ(*small[4], 14);
+  ASSERT_EQ(large.Size(), 1U);
+  EXPECT_EQ(*large[0], 1);
+  EXPECT_TRUE(large.IsInline());
+}
+
+TEST(SmallVectorTest, ShrinkToFitReturnsInline) {
+  s21::SmallVector<int, 4> vec;
+  vec.Reserve(100);
+  EXPECT_FALSE(vec.IsInline());
+  vec.PushBack(7);
+  vec.ShrinkToFit();
+  EXPECT_TRUE(vec.IsInline());
+  EXPECT_EQ(vec.Capacity(), 4U);
+  EXPECT_EQ(vec.Front(), 7);
+  vec.Clear();
+  EXPECT_TRUE(vec.Empty());
+}
+
+namespace {
+
+// Копия бросает на countdown-м вызове; перемещения нет, поэтому рост копирует
+struct Brittle {
+  static int countdown;
+  explicit Brittle(int v) : value(v) {}
+  Brittle(const Brittle& other) : value(other.value) {
+    if (countdown > 0 && --countdown == 0) throw std::runtime_error("copy");
+  }
+  Brittle& operator=(const Brittle&) = default;
+
+  int value;
+};
+
+int Brittle::countdown = 0;
+
+}  // namespace
+
+TEST(SmallVectorTest, GrowthToHeapKeepsVectorOnThrow) {
+  s21::SmallVector<Brittle, 3> vec;
+  for (int i = 0; i < 3; ++i) vec.EmplaceBack(i);
+  Brittle::countdown = 2;
+  EXPECT_THROW(vec.EmplaceBack(3), std::runtime_error);
+  Brittle::countdown = 0;
+  EXPECT_TRUE(vec.IsInline());
+  ASSERT_EQ(vec.Size(), 3U);
+  for (int i = 0; i < 3; ++i) EXPECT_EQ(vec[i].value, i);
+  vec.EmplaceBack(3);
+  EXPECT_FALSE(vec.IsInline());
+  EXPECT_EQ(vec[3].value, 3);
+}
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "../soa_vector/s21_soa_vector.h"
+#include "test.h"
+
+namespace {
+
+struct Order {
+  int id;
+  double price;
+  std::string customer;
+};
+
+using Orders = s21::SoAVector<int, double, std::string>;
+
+}  // namespace
+
+TEST(SoAVectorTest, pushEmplaceAndAt) {
+  Orders orders;
+  EXPECT_TRUE(orders.Empty());
+  orders.PushBack(std::make_tuple(1, 2.5, std::string("ann")));
+  auto row = orders.EmplaceBack(2, 4.0, "bob");
+  EXPECT_EQ(std::get<0>(row), 2);
+  EXPECT_EQ(orders.Size(), 2u);
+  EXPECT_EQ(std::get<2>(orders.At(0)), "ann");
+  EXPECT_EQ(std::get<1>(orders.Back()), 4.0);
+  EXPECT_EQ(std::get<0>(orders.Front()), 1);
+  EXPECT_THROW(orders.At(2), std::out_of_range);
+  const Orders &view = orders;
+  EXPECT_THROW(view.At(5), std::out_of_range);
+  EXPECT_THROW(Orders().Front(), std::out_of_range);
+}
+
+TEST(SoAVectorTest, rowBindingsAndAssignment) {
+  Orders orders = {{1, 1.0, "a"}, {2, 2.0, "b"}};
+  auto [id, price, customer] = orders[1];
+  price = 7.5;
+  customer += "c";
+  EXPECT_EQ(id, 2);
+  EXPECT_EQ(orders.Data<1>()[1], 7.5);
+  EXPECT_EQ(orders.Column<2>()[1], "bc");
+  orders[0] = std::make_tuple(10, 0.5, std::string("z"));
+  EXPECT_EQ(orders.At(0), std::make_tuple(10, 0.5, std::string("z")));
+}
+
+TEST(SoAVectorTest, iteratorsWithAlgorithms) {
+  s21::SoAVector<int, double> soa;
+  for (int i = 0; i < 10; ++i) {
+    soa.EmplaceBack(i, i * 0.5);
+  }
+  EXPECT_EQ(soa.End() - soa.Begin(), 10);
+  auto found = std::find_if(soa.Begin(), soa.End(), [](const auto &row) {
+    return std::get<1>(row) > 2.0;
+  });
+  EXPECT_EQ(std::get<0>(*found), 5);
+  int sum = 0;
+  for (auto it = soa.Begin(); it != soa.End(); ++it) {
+    sum += std::get<0>(*it);
+  }
+  EXPECT_EQ(sum, 45);
+  s21::SoAVector<int, double>::constIterator it = soa.Begin();
+  EXPECT_EQ(std::get<1>(it[4]), 2.0);
+  EXPECT_EQ(std::get<0>(*(soa.End() - 1)), 9);
+}
+
+TEST(SoAVectorTest, columnsAreContiguous) {
+  s21::SoAVector<int, float> soa(100);
+  EXPECT_EQ(soa.Size(), 100u);
+  std::iota(soa.Data<0>(), soa.Data<0>() + soa.Size(), 0);
+  soa.Column<1>().Fill(2.0f);
+  const auto &view = soa;
+  EXPECT_EQ(std::accumulate(view.Data<0>(), view.Data<0>() + 100, 0), 4950);
+  EXPECT_EQ(view.Column<1>().Data()[99], 2.0f);
+  EXPECT_EQ(std::get<0>(view[42]), 42);
+}
+
+TEST(SoAVectorTest, recordsRoundTrip) {
+  s21::Vector<Order> records = {{1, 9.5, "ann"}, {2, 3.0, "bob"}};
+  Orders orders = Orders::FromRecords(records, &Order::id, &Order::price,
+                                      &Order::customer);
+  ASSERT_EQ(orders.Size(), 2u);
+  EXPECT_EQ(orders.Column<2>()[1], "bob");
+  orders.EmplaceBack(3, 1.25, "cid");
+  s21::Vector<Order> back =
+      orders.ToRecords(&Order::id, &Order::price, &Order::customer);
+  ASSERT_EQ(back.Size(), 3u);
+  EXPECT_EQ(back[0].price, 9.5);
+  EXPECT_EQ(back[2].customer, "cid");
+}
+
+TEST(SoAVectorTest, capacityAndRemoval) {
+  s21::SoAVector<int, double> soa;
+  soa.Reserve(64);
+  EXPECT_GE(soa.Capacity(), 64u);
+  EXPECT_GT(soa.MaxSize(), 0u);
+  soa.EmplaceBack(1, 1.0);
+  soa.EmplaceBack(2, 2.0);
+  soa.PopBack();
+  EXPECT_EQ(soa.Size(), 1u);
+  EXPECT_EQ(soa.Column<1>().Size(), 1u);
+  soa.ShrinkToFit();
+  EXPECT_EQ(soa.Capacity(), 1u);
+  soa.Clear();
+  EXPECT_TRUE(soa.Empty());
+}
+
+TEST(SoAVectorTest, copyMoveAndSwap) {
+  Orders first = {{1, 1.0, "a"}};
+  Orders copy = first;
+  std::get<2>(copy[0]) = "changed";
+  EXPECT_EQ(std::get<2>(first[0]), "a");
+  Orders second = {{5, 5.0, "e"}, {6, 6.0, "f"}};
+  first.Swap(second);
+  EXPECT_EQ(first.Size(), 2u);
+  EXPECT_EQ(second.Size(), 1u);
+  Orders moved = std::move(first);
+  EXPECT_EQ(std::get<0>(moved[1]), 6);
+}
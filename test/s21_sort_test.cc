@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../sort/s21_sort.h"
+#include "test.h"
+
+namespace {
+
+uint64_t NextRandom(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+// Входные данные, на которых ломаются наивные quicksort
+std::vector<std::vector<int>> MakePatterns(size_t size) {
+  std::vector<std::vector<int>> patterns(6, std::vector<int>(size));
+  uint64_t state = 42;
+  for (size_t i = 0; i < size; ++i) {
+    int value = static_cast<int>(i);
+    patterns[0][i] = static_cast<int>(NextRandom(state) % 1000000);
+    patterns[1][i] = value;
+    patterns[2][i] = static_cast<int>(size) - value;
+    patterns[3][i] = 7;
+    patterns[4][i] = i < size / 2 ? value : static_cast<int>(size) - value;
+    patterns[5][i] = static_cast<int>(NextRandom(state) % 4);
+  }
+  return patterns;
+}
+
+template <typename T>
+void ExpectRadixMatchesStdSort(std::vector<T> values) {
+  std::vector<T> expected = values;
+  std::sort(expected.begin(), expected.end());
+  for (auto digit : {s21::RadixDigit::kAuto, s21::RadixDigit::k8,
+                     s21::RadixDigit::k11, s21::RadixDigit::k16}) {
+    std::vector<T> actual = values;
+    s21::RadixSort(actual.data(), actual.data() + actual.size(), digit);
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+}  // namespace
+
+TEST(SortTest, pdqSortPatterns) {
+  for (size_t size : {0, 1, 2, 23, 24, 100, 129, 5000}) {
+    for (std::vector<int> values : MakePatterns(size)) {
+      std::vector<int> expected = values;
+      std::sort(expected.begin(), expected.end());
+      s21::PdqSort(values.begin(), values.end());
+      EXPECT_EQ(values, expected);
+    }
+  }
+}
+
+TEST(SortTest, pdqSortComparatorAndStrings) {
+  s21::Vector<std::string> words = {"pear", "apple", "fig", "kiwi", "banana"};
+  s21::PdqSort(words.Begin(), words.End(),
+               [](const std::string &a, const std::string &b) {
+                 return a.size() < b.size() || (a.size() == b.size() && a < b);
+               });
+  EXPECT_EQ(words[0], "fig");
+  EXPECT_EQ(words[2], "pear");
+  EXPECT_EQ(words[4], "banana");
+  std::vector<int> values = MakePatterns(1000)[0];
+  s21::PdqSort(values.begin(), values.end(), std::greater<>());
+  EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+}
+
+TEST(SortTest, radixSortIntegers) {
+  uint64_t state = 7;
+  std::vector<uint64_t> unsigned_keys(3000);
+  std::vector<int32_t> signed_keys(3000);
+  std::vector<int8_t> bytes(3000);
+  for (size_t i = 0; i < unsigned_keys.size(); ++i) {
+    unsigned_keys[i] = NextRandom(state);
+    signed_keys[i] = static_cast<int32_t>(NextRandom(state));
+    bytes[i] = static_cast<int8_t>(NextRandom(state));
+  }
+  signed_keys[0] = std::numeric_limits<int32_t>::min();
+  signed_keys[1] = std::numeric_limits<int32_t>::max();
+  ExpectRadixMatchesStdSort(unsigned_keys);
+  ExpectRadixMatchesStdSort(signed_keys);
+  ExpectRadixMatchesStdSort(bytes);
+  ExpectRadixMatchesStdSort(std::vector<uint16_t>{5, 5, 1, 65535, 0});
+}
+
+TEST(SortTest, radixSortFloats) {
+  const float inf = std::numeric_limits<float>::infinity();
+  std::vector<float> floats = {3.5f,  -0.25f, 0.0f, -1e30f, 1e-30f,
+                               -7.0f, 2.0f,   inf,  -inf};
+  ExpectRadixMatchesStdSort(floats);
+  std::vector<double> doubles(2000);
+  uint64_t state = 99;
+  for (double &value : doubles) {
+    value = static_cast<int64_t>(NextRandom(state)) / 1e6;
+  }
+  ExpectRadixMatchesStdSort(doubles);
+  // -0.0 и +0.0 различаются ключом: отрицательный ноль идёт первым
+  std::vector<double> zeros = {0.0, -0.0};
+  s21::RadixSort(zeros.data(), zeros.data() + 2);
+  EXPECT_TRUE(std::signbit(zeros[0]));
+}
+
+TEST(SortTest, radixSortLargeUsesBuckets) {
+  // Достаточно элементов для раскладки по старшей цифре
+  std::vector<uint32_t> keys(s21::sort_detail::kMsdRadixThreshold + 17);
+  uint64_t state = 3;
+  for (uint32_t &key : keys) {
+    key = static_cast<uint32_t>(NextRandom(state));
+  }
+  std::vector<uint32_t> expected = keys;
+  std::sort(expected.begin(), expected.end());
+  s21::RadixSort(keys.data(), keys.data() + keys.size());
+  EXPECT_EQ(keys, expected);
+  // Все ключи в одной старшей корзине
+  std::vector<uint64_t> small(s21::sort_detail::kMsdRadixThreshold);
+  for (size_t i = 0; i < small.size(); ++i) {
+    small[i] = (i * 7919) % 1000;
+  }
+  s21::RadixSort(small.data(), small.data() + small.size());
+  EXPECT_TRUE(std::is_sorted(small.begin(), small.end()));
+}
+
+TEST(SortTest, sortDispatch) {
+  s21::Vector<float> keys(5000);
+  uint64_t state = 11;
+  for (size_t i = 0; i < keys.Size(); ++i) {
+    keys[i] = static_cast<float>(static_cast<int32_t>(NextRandom(state)));
+  }
+  s21::Sort(keys.Data(), keys.Data() + keys.Size());
+  EXPECT_TRUE(std::is_sorted(keys.Begin(), keys.End()));
+  s21::Sort(keys.Data(), keys.Data() + keys.Size(), std::greater<>());
+  EXPECT_TRUE(std::is_sorted(keys.Begin(), keys.End(), std::greater<>()));
+  std::vector<std::pair<int, int>> pairs = {{2, 1}, {1, 2}, {2, 0}};
+  s21::Sort(pairs.begin(), pairs.end());
+  EXPECT_EQ(pairs.front(), std::make_pair(1, 2));
+}
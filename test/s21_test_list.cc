@@ -1,3 +1,9 @@
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
 #include "../list/s21_list.h"
 #include "test.h"
 
@@ -204,6 +210,84 @@ TEST(ListTest, Sort) {
   EXPECT_EQ(list.Back(), 3);
 }
 
+TEST(ListTest, SortEmptyAndSingle) {
+  s21::List<int> empty;
+  empty.Sort();
+  EXPECT_TRUE(empty.Empty());
+  s21::List<int> single = {7};
+  single.Sort();
+  EXPECT_EQ(single.Front(), 7);
+  EXPECT_EQ(single.Back(), 7);
+}
+
+TEST(ListTest, SortIsStableWithComparator) {
+  s21::List<std::pair<int, int>> list;
+  for (int i = 0; i < 100; ++i) list.PushBack({i % 7, i});
+  list.Sort([](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first < b.first;
+  });
+  std::pair<int, int> prev = {-1, -1};
+  for (auto it = list.Begin(); it != list.End(); ++it) {
+    if ((*it).first == prev.first) {
+      EXPECT_LT(prev.second, (*it).second);
+    }
+    EXPECT_LE(prev.first, (*it).first);
+    prev = *it;
+  }
+  EXPECT_EQ(list.Size(), 100);
+}
+
+TEST(ListTest, SortRelinksNodes) {
+  s21::List<int> list;
+  std::map<int, const int*> addresses;
+  for (int i = 0; i < 1000; ++i) list.PushBack((i * 7919) % 1000);
+  for (auto it = list.Begin(); it != list.End(); ++it) addresses[*it] = &*it;
+  list.Sort(std::greater<>());
+  int expected = 999;
+  for (auto it = list.Begin(); it != list.End(); ++it, --expected) {
+    EXPECT_EQ(*it, expected);
+    EXPECT_EQ(&*it, addresses[*it]);
+  }
+  EXPECT_EQ(expected, -1);
+}
+
+TEST(ListTest, SortMatchesStdList) {
+  std::mt19937 gen(42);
+  s21::List<int> list;
+  std::list<int> reference;
+  for (int i = 0; i < 5000; ++i) {
+    int value = static_cast<int>(gen() % 1000);
+    list.PushBack(value);
+    reference.push_back(value);
+  }
+  list.Sort();
+  reference.sort();
+  EXPECT_EQ(list.Back(), reference.back());
+  // Обратный обход проверяет восстановленные previous и tail_
+  while (!reference.empty()) {
+    ASSERT_EQ(list.Back(), reference.back());
+    list.PopBack();
+    reference.pop_back();
+  }
+  EXPECT_TRUE(list.Empty());
+}
+
+TEST(ListTest, SortKeepsNodesWhenComparatorThrows) {
+  s21::List<int> list;
+  for (int i = 0; i < 100; ++i) list.PushBack(100 - i);
+  int calls = 0;
+  EXPECT_THROW(list.Sort([&calls](int a, int b) {
+    if (++calls == 150) throw std::runtime_error("compare");
+    return a < b;
+  }),
+               std::runtime_error);
+  EXPECT_EQ(list.Size(), 100);
+  int sum = 0;
+  for (auto it = list.Begin(); it != list.End(); ++it) sum += *it;
+  EXPECT_EQ(sum, 5050);
+  while (!list.Empty()) list.PopBack();
+}
+
 TEST(ListTest, Unique) {
   s21::List<int> list = {1, 1, 2, 2, 3, 3};
   list.Unique();
@@ -371,3 +455,28 @@ TEST(ListTest, OperatorDereference) {
   ++it;
   EXPECT_THROW(*it, std::out_of_range);
 }
+
+TEST(ListTest, EmplaceMoveOnly) {
+  s21::List<std::unique_ptr<int>> list;
+  list.PushBack(std::make_unique<int>(2));
+  list.PushFront(std::make_unique<int>(1));
+  list.EmplaceBack(new int(4));
+  auto it = list.Begin();
+  ++it;
+  ++it;
+  list.Emplace(it, new int(3));
+  int expected = 1;
+  for (auto iter = list.Begin(); iter != list.End(); ++iter) {
+    EXPECT_EQ(**iter, expected++);
+  }
+  EXPECT_EQ(list.Size(), 4);
+}
+
+TEST(ListTest, PushBackMovesString) {
+  s21::List<std::string> list;
+  std::string value(100, 'x');
+  list.PushBack(std::move(value));
+  EXPECT_TRUE(value.empty());
+  EXPECT_EQ(list.EmplaceFront(3, 'y'), "yyy");
+  EXPECT_EQ(list.Back().size(), 100);
+}
@@ -1,3 +1,5 @@
+#include <memory>
+
 #include "../queue/s21_queue.h"
 #include "test.h"
 
@@ -138,3 +140,13 @@ TEST(QueueTest, InsertManyBack) {
 //     s21::Queue<int> queue;
 //     EXPECT_THROW(queue.Pop(), std::out_of_range);
 // }
+
+TEST(QueueTest, EmplaceMoveOnly) {
+  s21::Queue<std::unique_ptr<int>> queue;
+  queue.Push(std::make_unique<int>(1));
+  *queue.Emplace(new int(0)) = 2;
+  EXPECT_EQ(*queue.Front(), 1);
+  EXPECT_EQ(*queue.Back(), 2);
+  queue.Pop();
+  EXPECT_EQ(*queue.Front(), 2);
+}
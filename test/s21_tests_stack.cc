@@ -1,3 +1,5 @@
+#include <memory>
+
 #include "../stack/s21_stack.h"
 #include "test.h"
 
@@ -116,3 +118,12 @@ TEST(StackTest, InsertManyBack) {
 //     s21::Stack<int> stack;
 //     EXPECT_THROW(stack.Pop(), std::out_of_range);
 // }
+
+TEST(StackTest, EmplaceMoveOnly) {
+  s21::Stack<std::unique_ptr<std::string>> stack;
+  stack.Push(std::make_unique<std::string>("bottom"));
+  stack.Emplace(new std::string("top"));
+  EXPECT_EQ(*stack.Top(), "top");
+  stack.Pop();
+  EXPECT_EQ(*stack.Top(), "bottom");
+}
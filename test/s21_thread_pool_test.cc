@@ -0,0 +1,118 @@
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../thread_pool/s21_thread_pool.h"
+#include "test.h"
+
+TEST(ThreadPoolTest, zeroThreadsThrows) {
+  EXPECT_THROW(s21::ThreadPool pool(0), std::invalid_argument);
+}
+
+TEST(ThreadPoolTest, submitReturnsResult) {
+  s21::ThreadPool pool(3);
+  EXPECT_EQ(pool.Size(), 3U);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 50; ++i) {
+    results.push_back(pool.Submit([i] { return i * i; }));
+  }
+  for (int i = 0; i < 50; ++i) {
+    EXPECT_EQ(results[i].get(), i * i);
+  }
+  auto failing = pool.Submit([]() -> int { throw std::runtime_error("x"); });
+  EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, parallelForRunsEveryIndexOnce) {
+  s21::ThreadPool pool(4);
+  std::vector<std::atomic<int>> hits(1000);
+  pool.ParallelFor(hits.size(), [&](size_t i) { hits[i].fetch_add(1); });
+  for (const auto &hit : hits) {
+    EXPECT_EQ(hit.load(), 1);
+  }
+}
+
+TEST(ThreadPoolTest, nestedParallelFor) {
+  // Потоков меньше, чем внешних задач: ожидающие потоки должны помогать
+  s21::ThreadPool pool(2);
+  std::atomic<int> total{0};
+  pool.ParallelFor(8, [&](size_t) {
+    pool.ParallelFor(8, [&](size_t) { total.fetch_add(1); });
+  });
+  EXPECT_EQ(total.load(), 64);
+}
+
+TEST(ThreadPoolTest, parallelForRethrows) {
+  s21::ThreadPool pool(2);
+  std::atomic<int> done{0};
+  EXPECT_THROW(pool.ParallelFor(10,
+                                [&](size_t i) {
+                                  if (i == 3) throw std::out_of_range("3");
+                                  done.fetch_add(1);
+                                }),
+               std::out_of_range);
+  // Остальные вызовы всё равно выполнены до возврата
+  EXPECT_EQ(done.load(), 9);
+}
+
+namespace {
+
+// Состояние потока из /proc: 'R' выполняется или ждёт процессор, 'S' спит
+char ThreadState(pid_t tid) {
+  std::ifstream stat("/proc/self/task/" + std::to_string(tid) + "/stat");
+  std::string line;
+  std::getline(stat, line);
+  size_t name_end = line.rfind(')');
+  return name_end + 2 < line.size() ? line[name_end + 2] : '?';
+}
+
+}  // namespace
+
+TEST(ThreadPoolTest, parallelForWaiterSleeps) {
+  // Пока задача в пуле не закончилась, ожидающий поток должен спать, а не
+  // крутиться: задача в пуле дожидается, когда ядро покажет его спящим
+  s21::ThreadPool pool(2);
+  std::thread::id waiter = std::this_thread::get_id();
+  pid_t waiter_tid = static_cast<pid_t>(syscall(SYS_gettid));
+  std::atomic<bool> in_pool{false};
+  std::atomic<int> waiter_running{0};
+  std::atomic<bool> saw_sleeping{false};
+  pool.ParallelFor(4, [&](size_t) {
+    if (std::this_thread::get_id() == waiter) {
+      ++waiter_running;
+      // Первые задачи ожидающего ждут, пока хотя бы одна окажется в пуле
+      while (!in_pool) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      --waiter_running;
+      return;
+    }
+    in_pool = true;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!saw_sleeping && std::chrono::steady_clock::now() < deadline) {
+      // Спит вне своих задач: до и после чтения состояния он не в задаче
+      saw_sleeping = waiter_running == 0 && ThreadState(waiter_tid) == 'S' &&
+                     waiter_running == 0;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+  EXPECT_TRUE(saw_sleeping);
+}
+
+TEST(ThreadPoolTest, destructorWaitsForTasks) {
+  std::atomic<int> done{0};
+  {
+    s21::ThreadPool pool(2);
+    for (int i = 0; i < 100; ++i) {
+      pool.Submit([&done] { done.fetch_add(1); });
+    }
+  }
+  EXPECT_EQ(done.load(), 100);
+}
@@ -0,0 +1,154 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../tombstone_vector/s21_tombstone_vector.h"
+#include "test.h"
+
+namespace {
+
+template <typename T>
+std::vector<T> Live(const s21::TombstoneVector<T> &v) {
+  std::vector<T> result;
+  v.ForEach([&result](const T &value) { result.push_back(value); });
+  return result;
+}
+
+// Присваивание бросает исключение, когда отсчёт доходит до нуля
+struct Brittle {
+  static int countdown;
+
+  explicit Brittle(int v) : value(v) {}
+  Brittle(const Brittle &) = default;
+  Brittle &operator=(const Brittle &other) {
+    if (--countdown == 0) throw std::runtime_error("assign");
+    value = other.value;
+    return *this;
+  }
+  Brittle &operator=(Brittle &&other) { return *this = other; }
+
+  bool operator==(const Brittle &other) const { return value == other.value; }
+
+  int value;
+};
+
+int Brittle::countdown = 0;
+
+}  // namespace
+
+TEST(TombstoneVectorTest, eraseMarksWithoutMoving) {
+  s21::TombstoneVector<std::string> v = {"a", "b", "c", "d", "e"};
+  v.SetCompactThreshold(1);
+  const std::string *d = &v[3];
+  EXPECT_TRUE(v.Erase(1));
+  EXPECT_FALSE(v.Erase(1));
+  EXPECT_TRUE(v.Erase(4));
+  EXPECT_EQ(v.Size(), 3u);
+  EXPECT_EQ(v.Slots(), 5u);
+  EXPECT_EQ(v.DeadCount(), 2u);
+  EXPECT_EQ(&v[3], d);
+  EXPECT_FALSE(v.IsAlive(1));
+  EXPECT_THROW(v.At(1), std::out_of_range);
+  EXPECT_THROW(v.Erase(5), std::out_of_range);
+  EXPECT_EQ(Live(v), (std::vector<std::string>{"a", "c", "d"}));
+  std::vector<size_t> slots;
+  for (auto it = v.Begin(); it != v.End(); ++it) slots.push_back(it.Slot());
+  EXPECT_EQ(slots, (std::vector<size_t>{0, 2, 3}));
+}
+
+TEST(TombstoneVectorTest, compactKeepsOrder) {
+  s21::TombstoneVector<int> v;
+  v.SetCompactThreshold(1);
+  for (int i = 0; i < 1000; ++i) v.PushBack(i);
+  for (size_t slot = 0; slot < 1000; slot += 3) v.Erase(slot);
+  for (size_t slot = 128; slot < 256; ++slot) v.Erase(slot);
+  std::vector<int> before = Live(v);
+  v.Compact();
+  EXPECT_EQ(v.DeadCount(), 0u);
+  EXPECT_EQ(v.Slots(), before.size());
+  EXPECT_EQ(Live(v), before);
+  for (size_t slot = 0; slot < v.Slots(); ++slot) {
+    ASSERT_EQ(v.At(slot), before[slot]);
+  }
+  v.PushBack(-1);
+  EXPECT_EQ(v[v.Slots() - 1], -1);
+}
+
+TEST(TombstoneVectorTest, thresholdTriggersCompaction) {
+  s21::TombstoneVector<int> v(s21::Vector<int>{1, 2, 3, 4, 5, 6, 7, 8});
+  EXPECT_EQ(v.CompactThreshold(), 0.5);
+  v.SetCompactThreshold(0.25);
+  v.Erase(0);
+  v.Erase(1);
+  EXPECT_EQ(v.Slots(), 8u);
+  v.Erase(2);
+  EXPECT_EQ(v.Slots(), 5u);
+  EXPECT_EQ(v.DeadCount(), 0u);
+  EXPECT_EQ(v[0], 4);
+  EXPECT_THROW(v.SetCompactThreshold(-0.1), std::invalid_argument);
+}
+
+TEST(TombstoneVectorTest, eraseIfCompactsOnce) {
+  s21::TombstoneVector<int> v;
+  for (int i = 0; i < 300; ++i) v.PushBack(i);
+  EXPECT_EQ(v.EraseIf([](int x) { return x % 4 != 0; }), 225u);
+  EXPECT_EQ(v.Slots(), 75u);
+  EXPECT_EQ(v.Size(), 75u);
+  EXPECT_EQ(v[74], 296);
+  EXPECT_EQ(v.EraseIf([](int x) { return x == 8; }), 1u);
+  EXPECT_EQ(v.Slots(), 75u);
+  EXPECT_FALSE(v.IsAlive(2));
+}
+
+TEST(TombstoneVectorTest, iteratorsSkipDeadWords) {
+  s21::TombstoneVector<int> v;
+  v.SetCompactThreshold(1);
+  for (int i = 0; i < 640; ++i) v.PushBack(i);
+  for (size_t slot = 0; slot < 639; ++slot) v.Erase(slot);
+  EXPECT_EQ(*v.Begin(), 639);
+  EXPECT_EQ(++v.Begin(), v.End());
+  const s21::TombstoneVector<int> &view = v;
+  s21::TombstoneVector<int>::constIterator it = view.Begin();
+  EXPECT_EQ(*it, 639);
+  v.Erase(639);
+  EXPECT_TRUE(v.Empty());
+  EXPECT_EQ(v.Begin(), v.End());
+}
+
+TEST(TombstoneVectorTest, releaseAndSwap) {
+  s21::TombstoneVector<std::string> a = {"x", "y", "z"};
+  a.Erase(1);
+  s21::TombstoneVector<std::string> b;
+  b.Swap(a);
+  EXPECT_TRUE(a.Empty());
+  s21::Vector<std::string> released = b.Release();
+  ASSERT_EQ(released.Size(), 2u);
+  EXPECT_EQ(released[1], "z");
+  EXPECT_EQ(b.Slots(), 0u);
+  b.Reserve(10);
+  b.EmplaceBack(3, 'q');
+  EXPECT_EQ(b.At(0), "qqq");
+  b.Clear();
+  EXPECT_TRUE(b.Empty());
+}
+
+TEST(TombstoneVectorTest, compactStaysConsistentOnThrow) {
+  s21::TombstoneVector<Brittle> v;
+  v.SetCompactThreshold(1);
+  std::vector<Brittle> expected;
+  for (int i = 0; i < 200; ++i) {
+    v.PushBack(Brittle(i));
+    if (i % 3 != 0) expected.push_back(Brittle(i));
+  }
+  for (size_t slot = 0; slot < 200; slot += 3) v.Erase(slot);
+  Brittle::countdown = 40;
+  EXPECT_THROW(v.Compact(), std::runtime_error);
+  Brittle::countdown = 0;
+  // Каждый живой элемент остался ровно в одном экземпляре и по порядку
+  EXPECT_EQ(Live(v), expected);
+  EXPECT_EQ(v.Size(), expected.size());
+  EXPECT_EQ(v.DeadCount(), v.Slots() - v.Size());
+  v.Compact();
+  EXPECT_EQ(Live(v), expected);
+  EXPECT_EQ(v.Slots(), expected.size());
+}
@@ -1,6 +1,11 @@
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <type_traits>
 #include <vector>
 
+#include "../memory/s21_mmap_allocator.h"
 #include "test.h"
 
 template <typename T>
@@ -319,7 +324,7 @@ TEST(VectorTest, insertMany) {
   auto newIter = my.InsertMany(myIter, s21::Vector<int>{100, 200, 300});
 
   EXPECT_EQ(my.Size(), 8);
-  EXPECT_EQ(my.Capacity(), 8);
+  EXPECT_GE(my.Capacity(), 8);
   EXPECT_EQ(*newIter, 2);
 }
 
@@ -364,4 +369,397 @@ TEST(VectorTest, erase) {
   for (size_t i = 0; i < my.Size(); ++i) {
     EXPECT_EQ(my.At(i), orig.at(i));
   }
-}
\ No newline at end of file
+}
+namespace {
+
+struct NoDefault {
+  explicit NoDefault(int v) : value(v) {}
+  int value;
+};
+
+struct Counted {
+  static int alive;
+  static int constructed;
+  Counted() : value(0) { ++alive, ++constructed; }
+  Counted(int v) : value(v) { ++alive, ++constructed; }
+  Counted(const Counted &other) : value(other.value) {
+    ++alive, ++constructed;
+  }
+  Counted(Counted &&other) noexcept : value(other.value) {
+    ++alive, ++constructed;
+  }
+  Counted &operator=(const Counted &) = default;
+  Counted &operator=(Counted &&) = default;
+  ~Counted() { --alive; }
+  int value;
+};
+
+int Counted::alive = 0;
+int Counted::constructed = 0;
+
+}  // namespace
+
+TEST(VectorTest, noDefaultConstructor) {
+  s21::Vector<NoDefault> my;
+  my.Reserve(10);
+  my.PushBack(NoDefault(1));
+  my.PushBack(NoDefault(3));
+  my.Insert(my.Begin() + 1, NoDefault(2));
+  my.Erase(my.Begin());
+  ASSERT_EQ(my.Size(), 2);
+  EXPECT_EQ(my[0].value, 2);
+  EXPECT_EQ(my[1].value, 3);
+}
+
+TEST(VectorTest, reserveDoesNotConstruct) {
+  Counted::constructed = 0;
+  {
+    s21::Vector<Counted> my;
+    my.Reserve(1000);
+    EXPECT_EQ(Counted::constructed, 0);
+    EXPECT_EQ(Counted::alive, 0);
+  }
+  EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(VectorTest, elementsDestroyedExactly) {
+  {
+    s21::Vector<Counted> my(3);
+    EXPECT_EQ(Counted::alive, 3);
+    my.Reserve(100);
+    EXPECT_EQ(Counted::alive, 3);
+    my.PushBack(Counted(7));
+    EXPECT_EQ(Counted::alive, 4);
+    my.PopBack();
+    EXPECT_EQ(Counted::alive, 3);
+    my.Erase(my.Begin());
+    EXPECT_EQ(Counted::alive, 2);
+    my.ShrinkToFit();
+    EXPECT_EQ(Counted::alive, 2);
+    EXPECT_EQ(my.Capacity(), 2);
+    my.Clear();
+    EXPECT_EQ(Counted::alive, 0);
+    my.PushBack(Counted(1));
+  }
+  EXPECT_EQ(Counted::alive, 0);
+}
+
+namespace {
+
+// Конструктор бросает исключение, когда обратный отсчёт доходит до нуля
+struct Fragile {
+  static int countdown;
+  static int alive;
+  Fragile() : Fragile(0) {}
+  explicit Fragile(int v) : value(v) { Tick(); }
+  Fragile(const Fragile &other) : value(other.value) { Tick(); }
+  // Перемещение не noexcept, поэтому при росте вектор должен копировать
+  Fragile(Fragile &&other) : value(other.value) {
+    other.value = -1;
+    Tick();
+  }
+  Fragile &operator=(const Fragile &) = default;
+  Fragile &operator=(Fragile &&) = default;
+  ~Fragile() { --alive; }
+
+  void Tick() {
+    if (countdown > 0 && --countdown == 0) throw std::runtime_error("ctor");
+    ++alive;
+  }
+
+  int value;
+};
+
+int Fragile::countdown = 0;
+int Fragile::alive = 0;
+
+}  // namespace
+
+TEST(VectorTest, constructorsReleaseMemoryOnThrow) {
+  Fragile::countdown = 4;
+  EXPECT_THROW(s21::Vector<Fragile>(10), std::runtime_error);
+  EXPECT_EQ(Fragile::alive, 0);
+  Fragile::countdown = 0;
+  {
+    s21::Vector<Fragile> source(10);
+    Fragile::countdown = 5;
+    EXPECT_THROW(s21::Vector<Fragile>{source}, std::runtime_error);
+    EXPECT_EQ(Fragile::alive, 10);
+    s21::Vector<Fragile> target(3);
+    Fragile::countdown = 5;
+    EXPECT_THROW(target = source, std::runtime_error);
+    EXPECT_EQ(target.Size(), 3);
+    EXPECT_EQ(Fragile::alive, 13);
+    // Бросает копия второго элемента списка в вектор
+    Fragile::countdown = 4;
+    using Fragiles = s21::Vector<Fragile>;
+    EXPECT_THROW((Fragiles{Fragile(1), Fragile(2)}), std::runtime_error);
+  }
+  EXPECT_EQ(Fragile::alive, 0);
+}
+
+TEST(VectorTest, growthKeepsVectorOnThrow) {
+  {
+    s21::Vector<Fragile> my;
+    for (int i = 0; i < 8; ++i) my.EmplaceBack(i);
+    ASSERT_EQ(my.Size(), my.Capacity());
+    // Бросает перенос пятого элемента в новый блок
+    Fragile::countdown = 6;
+    EXPECT_THROW(my.EmplaceBack(8), std::runtime_error);
+    Fragile::countdown = 6;
+    EXPECT_THROW(my.Insert(my.Begin() + 2, Fragile(8)), std::runtime_error);
+    Fragile::countdown = 3;
+    EXPECT_THROW(my.Reserve(100), std::runtime_error);
+    Fragile extra[] = {Fragile(8), Fragile(9)};
+    // Бросает перенос хвоста, когда начало уже перенесено
+    Fragile::countdown = 8;
+    EXPECT_THROW(my.Insert(my.Begin() + 4, extra, extra + 2),
+                 std::runtime_error);
+    ASSERT_EQ(my.Size(), 8);
+    for (int i = 0; i < 8; ++i) EXPECT_EQ(my[i].value, i);
+    EXPECT_EQ(Fragile::alive, 10);
+    my.EmplaceBack(8);
+    EXPECT_EQ(my[8].value, 8);
+  }
+  EXPECT_EQ(Fragile::alive, 0);
+}
+
+TEST(VectorTest, pushBackOwnElement) {
+  s21::Vector<std::string> my = {"first"};
+  for (int i = 0; i < 10; ++i) {
+    my.PushBack(my[0]);
+  }
+  for (size_t i = 0; i < my.Size(); ++i) {
+    EXPECT_EQ(my[i], "first");
+  }
+}
+
+namespace {
+
+// Владеет памятью, но не ссылается на себя, поэтому переносится memcpy
+struct Owning {
+  static int moves;
+  explicit Owning(int v) : ptr(new int(v)) {}
+  Owning(const Owning &other) : ptr(new int(*other.ptr)) {}
+  Owning(Owning &&other) noexcept : ptr(other.ptr) {
+    other.ptr = nullptr;
+    ++moves;
+  }
+  Owning &operator=(const Owning &other) {
+    *ptr = *other.ptr;
+    return *this;
+  }
+  Owning &operator=(Owning &&other) noexcept {
+    std::swap(ptr, other.ptr);
+    return *this;
+  }
+  ~Owning() { delete ptr; }
+  int *ptr;
+};
+
+int Owning::moves = 0;
+
+}  // namespace
+
+template <>
+struct s21::IsTriviallyRelocatable<Owning> : std::true_type {};
+
+TEST(VectorTest, trivialRelocationSkipsMoves) {
+  Owning::moves = 0;
+  s21::Vector<Owning> my;
+  for (int i = 0; i < 100; ++i) {
+    my.PushBack(Owning(i));
+  }
+  // по одному перемещению на вставку, перенос при росте их не добавляет
+  EXPECT_EQ(Owning::moves, 100);
+  my.ShrinkToFit();
+  my.Insert(my.Begin(), Owning(-1));
+  EXPECT_EQ(Owning::moves, 101);
+  EXPECT_EQ(*my[0].ptr, -1);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(*my[i + 1].ptr, i);
+  }
+}
+
+TEST(VectorTest, insertReusesCapacity) {
+  s21::Vector<std::string> my = {"a", "c"};
+  my.Reserve(10);
+  auto data = my.Data();
+  my.Insert(my.Begin() + 1, "b");
+  my.Insert(my.Begin(), my[2]);
+  my.Insert(my.End(), my[0]);
+  EXPECT_EQ(my.Data(), data);
+  std::vector<std::string> expected = {"c", "a", "b", "c", "c"};
+  ASSERT_EQ(my.Size(), expected.size());
+  for (size_t i = 0; i < my.Size(); ++i) {
+    EXPECT_EQ(my[i], expected[i]);
+  }
+}
+
+TEST(VectorTest, insertRange) {
+  std::vector<int> orig = {1, 2, 3, 4, 5};
+  s21::Vector<int> my = {1, 2, 3, 4, 5};
+  my.Reserve(20);
+  std::vector<int> values = {10, 20, 30};
+  for (size_t pos : {0, 4, 8, 11}) {
+    orig.insert(orig.begin() + pos, values.begin(), values.end());
+    auto it = my.Insert(my.Begin() + pos, values.begin(), values.end());
+    EXPECT_EQ(it, my.Begin() + pos);
+  }
+  std::list<int> tail = {7, 8};
+  orig.insert(orig.begin() + 1, tail.begin(), tail.end());
+  my.Insert(my.Begin() + 1, tail.begin(), tail.end());
+  ASSERT_EQ(my.Size(), orig.size());
+  for (size_t i = 0; i < my.Size(); ++i) {
+    EXPECT_EQ(my[i], orig[i]);
+  }
+}
+
+TEST(VectorTest, insertRangeGrows) {
+  s21::Vector<std::string> my = {"a", "e"};
+  std::vector<std::string> values = {"b", "c", "d"};
+  auto it = my.Insert(my.Begin() + 1, values.begin(), values.end());
+  EXPECT_EQ(*it, "b");
+  ASSERT_EQ(my.Size(), 5);
+  EXPECT_EQ(my[4], "e");
+}
+
+TEST(VectorTest, eraseRange) {
+  s21::Vector<std::string> my = {"a", "b", "c", "d", "e"};
+  auto it = my.Erase(my.Begin() + 1, my.Begin() + 3);
+  EXPECT_EQ(*it, "d");
+  ASSERT_EQ(my.Size(), 3);
+  EXPECT_EQ(my[0], "a");
+  EXPECT_EQ(my[2], "e");
+  EXPECT_EQ(my.Erase(my.Begin(), my.Begin()), my.Begin());
+  EXPECT_EQ(my.Size(), 3);
+}
+
+TEST(VectorTest, eraseIf) {
+  s21::Vector<int> my;
+  for (int i = 0; i < 100; ++i) {
+    my.PushBack(i);
+  }
+  EXPECT_EQ(my.EraseIf([](int v) { return v % 3 == 0; }), 34);
+  ASSERT_EQ(my.Size(), 66);
+  EXPECT_EQ(my[0], 1);
+  EXPECT_EQ(my[1], 2);
+  EXPECT_EQ(my[2], 4);
+  auto end = my.RemoveIf([](int v) { return v > 10; });
+  my.Erase(end, my.End());
+  EXPECT_EQ(my.Size(), 7);
+}
+
+TEST(VectorTest, insertInputRange) {
+  s21::Vector<int> my = {1, 5};
+  std::istringstream stream("2 3 4");
+  my.Insert(my.Begin() + 1, std::istream_iterator<int>(stream),
+            std::istream_iterator<int>());
+  ASSERT_EQ(my.Size(), 5);
+  for (size_t i = 0; i < my.Size(); ++i) {
+    EXPECT_EQ(my[i], static_cast<int>(i) + 1);
+  }
+}
+
+TEST(VectorTest, emplaceMoveOnly) {
+  s21::Vector<std::unique_ptr<int>> my;
+  for (int i = 0; i < 10; ++i) {
+    if (i % 2) {
+      my.PushBack(std::make_unique<int>(i));
+    } else {
+      my.EmplaceBack(new int(i));
+    }
+  }
+  auto it = my.Emplace(my.Begin() + 3, new int(-1));
+  EXPECT_EQ(**it, -1);
+  my.Insert(my.Begin(), std::make_unique<int>(-2));
+  ASSERT_EQ(my.Size(), 12);
+  EXPECT_EQ(*my[0], -2);
+  EXPECT_EQ(*my[4], -1);
+  EXPECT_EQ(*my[11], 9);
+  my.Erase(my.Begin() + 4);
+  EXPECT_EQ(*my[4], 3);
+}
+
+TEST(VectorTest, emplaceBackArguments) {
+  s21::Vector<std::string> my;
+  EXPECT_EQ(my.EmplaceBack(3, 'a'), "aaa");
+  std::string value(50, 'b');
+  my.PushBack(std::move(value));
+  EXPECT_TRUE(value.empty());
+  for (int i = 0; i < 10; ++i) {
+    my.EmplaceBack(my[0]);
+  }
+  EXPECT_EQ(my[11], "aaa");
+}
+
+TEST(VectorTest, growthPolicies) {
+  s21::Vector<int, s21::GrowByHalf> half;
+  std::vector<size_t> capacities;
+  for (int i = 0; i < 20; ++i) {
+    half.PushBack(i);
+    if (capacities.empty() || capacities.back() != half.Capacity()) {
+      capacities.push_back(half.Capacity());
+    }
+  }
+  EXPECT_EQ(capacities,
+            (std::vector<size_t>{1, 2, 3, 4, 6, 9, 13, 19, 28}));
+
+  s21::Vector<int, s21::GrowByChunk<100>> chunked;
+  for (int i = 0; i < 250; ++i) {
+    chunked.PushBack(i);
+  }
+  EXPECT_EQ(chunked.Capacity(), 300);
+  chunked.InsertManyBack(1, 2, 3);
+  EXPECT_EQ(chunked.Capacity(), 300);
+  EXPECT_EQ(chunked[251], 2);
+}
+
+TEST(VectorTest, mmapAllocatorGrowsLargeVector) {
+  // порог 4 КБ, чтобы рост через mremap начался уже на тысяче элементов
+  s21::Vector<uint64_t, s21::GrowByDoubling,
+              s21::MmapAllocator<uint64_t, 4096>>
+      my;
+  for (uint64_t i = 0; i < 300000; ++i) {
+    my.PushBack(i * 3);
+  }
+  for (uint64_t i = 0; i < 300000; i += 997) {
+    EXPECT_EQ(my[i], i * 3);
+  }
+  my.Erase(my.Begin(), my.Begin() + 299990);
+  my.ShrinkToFit();
+  EXPECT_EQ(my.Capacity(), 10);
+  EXPECT_EQ(my[9], 299999u * 3);
+  s21::Vector<uint64_t, s21::GrowByDoubling,
+              s21::MmapAllocator<uint64_t, 4096>>
+      copy(my);
+  EXPECT_EQ(copy.Back(), 299999u * 3);
+}
+
+TEST(VectorTest, mmapAllocatorNonTrivialType) {
+  s21::Vector<std::string, s21::GrowByDoubling,
+              s21::MmapAllocator<std::string, 4096>>
+      my;
+  for (int i = 0; i < 1000; ++i) {
+    my.EmplaceBack(std::to_string(i));
+  }
+  EXPECT_EQ(my[999], "999");
+}
+
+TEST(VectorTest, alignedVector) {
+  s21::AlignedVector<float, 64> my;
+  for (int i = 0; i < 100; ++i) {
+    my.PushBack(static_cast<float>(i));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(my.Data()) % 64, 0u);
+    EXPECT_EQ(my.Capacity() % 16, 0u);
+  }
+  EXPECT_EQ(my[99], 99.0f);
+  my.Reserve(130);
+  EXPECT_EQ(my.Capacity(), 144);
+  my.ShrinkToFit();
+  EXPECT_EQ(my.Capacity(), 112);
+  s21::AlignedVector<double, 32> init = {1.0, 2.0, 3.0, 4.0, 5.0};
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(init.Data()) % 32, 0u);
+  EXPECT_EQ(init.Capacity(), 8);
+  EXPECT_EQ(init.Size(), 5);
+}
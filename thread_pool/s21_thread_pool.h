@@ -0,0 +1,86 @@
+#ifndef SRC_THREAD_POOL_S21_THREAD_POOL_H_
+#define SRC_THREAD_POOL_S21_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace s21 {
+
+/*
+ * Пул потоков с кражей задач. У каждого потока своя очередь: он берёт
+ * задачи с её конца (последние добавленные, их данные ещё в кэше), а
+ * свободные потоки забирают задачи с начала чужих очередей. Задачи,
+ * добавленные из потока пула, попадают в его очередь, поэтому вложенный
+ * параллелизм не создаёт общей точки конкуренции.
+ *
+ * Поток, ожидающий ParallelFor, сам выполняет задачи из очередей, так что
+ * ParallelFor можно вызывать изнутри задач без взаимной блокировки. Когда
+ * очереди пусты, он спит до завершения последнего вызова, а не крутится.
+ */
+class ThreadPool {
+ public:
+  using sizeType = size_t;
+
+  // Число потоков по умолчанию: hardware_concurrency(), но не меньше 1
+  static sizeType DefaultThreads();
+
+  explicit ThreadPool(sizeType threads = DefaultThreads());
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  // Дожидается выполнения всех поставленных задач
+  ~ThreadPool();
+
+  sizeType Size() const;
+
+  // Ставит fn в очередь, исключение из fn передаётся через future
+  template <typename Function>
+  std::future<std::invoke_result_t<Function>> Submit(Function fn);
+
+  /*
+   * Выполняет fn(0) ... fn(count - 1) в пуле и ждёт завершения. Если
+   * какие-то вызовы бросили исключение, после ожидания пробрасывается
+   * первое из них.
+   */
+  template <typename Function>
+  void ParallelFor(sizeType count, Function fn);
+
+ private:
+  using Task = std::function<void()>;
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  void Push(Task task);
+  bool TryRunTask();
+  bool TryPop(sizeType index, bool steal, Task &task);
+  void WorkerLoop(sizeType index);
+  // Индекс очереди текущего потока или Size(), если поток не из пула
+  sizeType CurrentIndex() const;
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  std::atomic<sizeType> pending_{0};
+  std::atomic<sizeType> next_queue_{0};
+  bool stop_ = false;
+};
+
+}  // namespace s21
+
+#include "s21_thread_pool.tpp"
+
+#endif  // SRC_THREAD_POOL_S21_THREAD_POOL_H_
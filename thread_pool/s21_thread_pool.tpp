@@ -0,0 +1,165 @@
+#ifndef SRC_THREAD_POOL_S21_THREAD_POOL_TPP_
+#define SRC_THREAD_POOL_S21_THREAD_POOL_TPP_
+
+namespace s21 {
+
+namespace detail {
+
+// Пул и очередь, к которым относится текущий поток
+inline thread_local const ThreadPool *current_pool = nullptr;
+inline thread_local size_t current_queue = 0;
+
+}  // namespace detail
+
+inline ThreadPool::sizeType ThreadPool::DefaultThreads() {
+  sizeType threads = std::thread::hardware_concurrency();
+  return threads ? threads : 1;
+}
+
+inline ThreadPool::ThreadPool(sizeType threads) {
+  if (threads == 0) {
+    throw std::invalid_argument("ThreadPool needs at least one thread");
+  }
+  for (sizeType i = 0; i < threads; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  workers_.reserve(threads);
+  for (sizeType i = 0; i < threads; ++i) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  }
+}
+
+inline ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread &worker : workers_) {
+    worker.join();
+  }
+}
+
+// queues_ заполнен до запуска потоков, а workers_ ещё растёт в конструкторе
+inline ThreadPool::sizeType ThreadPool::Size() const { return queues_.size(); }
+
+template <typename Function>
+std::future<std::invoke_result_t<Function>> ThreadPool::Submit(Function fn) {
+  using Result = std::invoke_result_t<Function>;
+  // std::function требует копируемости, packaged_task только перемещается
+  auto task = std::make_shared<std::packaged_task<Result()>>(std::move(fn));
+  std::future<Result> future = task->get_future();
+  Push([task] { (*task)(); });
+  return future;
+}
+
+template <typename Function>
+void ThreadPool::ParallelFor(sizeType count, Function fn) {
+  if (count == 0) return;
+  if (count == 1) {
+    fn(0);
+    return;
+  }
+  struct State {
+    std::atomic<sizeType> remaining;
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr error;
+  } state;
+  state.remaining.store(count, std::memory_order_relaxed);
+  for (sizeType i = 0; i < count; ++i) {
+    Push([&state, &fn, i] {
+      std::exception_ptr error;
+      try {
+        fn(i);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      // Счётчик уменьшается под блокировкой: увидев ноль, ожидающий
+      // захватит mutex и уничтожит state только после её снятия
+      std::lock_guard<std::mutex> lock(state.mutex);
+      if (error && !state.error) state.error = error;
+      if (state.remaining.fetch_sub(1, std::memory_order_release) == 1) {
+        state.done.notify_one();
+      }
+    });
+  }
+  // Помогаем, пока в очередях есть задачи. Наши задачи туда больше не
+  // попадают, поэтому если очереди пусты, все они уже выполняются другими
+  // потоками, и остаётся заснуть до завершения последней
+  while (state.remaining.load(std::memory_order_acquire) != 0 &&
+         TryRunTask()) {
+  }
+  std::unique_lock<std::mutex> lock(state.mutex);
+  state.done.wait(lock, [&state] {
+    return state.remaining.load(std::memory_order_acquire) == 0;
+  });
+  if (state.error) std::rethrow_exception(state.error);
+}
+
+inline void ThreadPool::Push(Task task) {
+  sizeType index = CurrentIndex();
+  if (index == Size()) {
+    index = next_queue_.fetch_add(1, std::memory_order_relaxed) % Size();
+  }
+  // Счётчик растёт до вставки, иначе взявший задачу поток может уменьшить
+  // его раньше и pending_ на мгновение перейдёт через ноль
+  pending_.fetch_add(1, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(task));
+  }
+  // Блокировка нужна, чтобы уведомление не потерялось между проверкой
+  // условия и засыпанием потока
+  { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+  wake_.notify_one();
+}
+
+inline bool ThreadPool::TryPop(sizeType index, bool steal, Task &task) {
+  Queue &queue = *queues_[index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty()) return false;
+  if (steal) {
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+  } else {
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+  }
+  return true;
+}
+
+inline bool ThreadPool::TryRunTask() {
+  sizeType home = CurrentIndex();
+  Task task;
+  bool found = home != Size() && TryPop(home, false, task);
+  for (sizeType i = 1; !found && i <= Size(); ++i) {
+    sizeType victim = (home + i) % Size();
+    found = victim != home && TryPop(victim, true, task);
+  }
+  if (!found) return false;
+  pending_.fetch_sub(1, std::memory_order_relaxed);
+  task();
+  return true;
+}
+
+inline void ThreadPool::WorkerLoop(sizeType index) {
+  detail::current_pool = this;
+  detail::current_queue = index;
+  while (true) {
+    if (TryRunTask()) continue;
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    wake_.wait(lock, [this] {
+      return stop_ || pending_.load(std::memory_order_acquire) != 0;
+    });
+    if (stop_ && pending_.load(std::memory_order_acquire) == 0) return;
+  }
+}
+
+inline ThreadPool::sizeType ThreadPool::CurrentIndex() const {
+  return detail::current_pool == this ? detail::current_queue : Size();
+}
+
+}  // namespace s21
+
+#endif  // SRC_THREAD_POOL_S21_THREAD_POOL_TPP_
@@ -0,0 +1,162 @@
+#ifndef SRC_TOMBSTONE_VECTOR_S21_TOMBSTONE_VECTOR_H_
+#define SRC_TOMBSTONE_VECTOR_S21_TOMBSTONE_VECTOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../bit_vector/s21_bit_vector.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+/*
+ * Vector с отложенным удалением. Erase(slot) не сдвигает хвост, а только
+ * сбрасывает бит элемента в битовой карте живых, поэтому стоит O(1).
+ * Итераторы и ForEach пропускают удалённые элементы: целиком мёртвые
+ * слова карты пропускаются за одну проверку. Удалённый элемент остаётся
+ * сконструированным, пока его не уберёт уплотнение.
+ *
+ * Compact() за один проход сдвигает живые элементы к началу. Он же
+ * вызывается из Erase и EraseIf, когда доля удалённых превышает порог
+ * (по умолчанию половина). После уплотнения номера ячеек меняются, поэтому
+ * при удалении по заранее собранным номерам порог нужно отключить
+ * (SetCompactThreshold(1)) или удалять через EraseIf.
+ */
+template <typename T>
+class TombstoneVector {
+ public:
+  template <bool kConst>
+  class LiveIterator;
+
+  using valueType = T;
+  using reference = T &;
+  using constReference = const T &;
+  using iterator = LiveIterator<false>;
+  using constIterator = LiveIterator<true>;
+  using sizeType = size_t;
+
+  static constexpr double kDefaultThreshold = 0.5;
+
+  // Прямой итератор по живым элементам
+  template <bool kConst>
+  class LiveIterator {
+    using Owner = std::conditional_t<kConst, const TombstoneVector,
+                                     TombstoneVector>;
+    using Value = std::conditional_t<kConst, const T, T>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = Value &;
+    using pointer = Value *;
+
+    LiveIterator() = default;
+    LiveIterator(Owner *owner, sizeType slot) : owner_(owner), slot_(slot) {}
+    template <bool kFromMutable = !kConst,
+              typename = std::enable_if_t<kFromMutable>>
+    operator LiveIterator<true>() const {
+      return {owner_, slot_};
+    }
+
+    reference operator*() const { return owner_->values_.Data()[slot_]; }
+    pointer operator->() const { return owner_->values_.Data() + slot_; }
+    // Номер ячейки, который принимает Erase
+    sizeType Slot() const { return slot_; }
+
+    LiveIterator &operator++() {
+      slot_ = owner_->NextAlive(slot_);
+      return *this;
+    }
+    LiveIterator operator++(int) {
+      LiveIterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const LiveIterator &other) const {
+      return slot_ == other.slot_;
+    }
+    bool operator!=(const LiveIterator &other) const {
+      return slot_ != other.slot_;
+    }
+
+   private:
+    Owner *owner_ = nullptr;
+    sizeType slot_ = 0;
+  };
+
+  TombstoneVector() = default;
+  // Все элементы values живые
+  explicit TombstoneVector(Vector<valueType> values);
+  TombstoneVector(std::initializer_list<valueType> const &items);
+
+  void Swap(TombstoneVector &other);
+
+  // Доступ по номеру ячейки; At бросает out_of_range и для удалённых
+  reference operator[](sizeType slot);
+  constReference operator[](sizeType slot) const;
+  reference At(sizeType slot);
+  constReference At(sizeType slot) const;
+  bool IsAlive(sizeType slot) const;
+
+  iterator Begin();
+  iterator End();
+  constIterator Begin() const;
+  constIterator End() const;
+  // Вызывает fn для каждого живого элемента по порядку
+  template <typename Function>
+  void ForEach(Function fn);
+  template <typename Function>
+  void ForEach(Function fn) const;
+
+  bool Empty() const;
+  // Число живых элементов
+  sizeType Size() const;
+  // Число ячеек вместе с удалёнными
+  sizeType Slots() const;
+  sizeType DeadCount() const;
+
+  void Reserve(sizeType size);
+  void Clear();
+
+  void PushBack(constReference value);
+  void PushBack(valueType &&value);
+  template <typename... Args>
+  reference EmplaceBack(Args &&...args);
+
+  // Помечает ячейку удалённой; false, если она уже была удалена
+  bool Erase(sizeType slot);
+  template <typename Predicate>
+  sizeType EraseIf(Predicate pred);
+
+  // Доля удалённых, после которой Erase уплотняет; 1 — никогда
+  void SetCompactThreshold(double ratio);
+  double CompactThreshold() const;
+  void Compact();
+  // Уплотняет и отдаёт элементы, оставляя контейнер пустым
+  Vector<valueType> Release();
+
+ private:
+  sizeType FirstAlive() const;
+  sizeType NextAlive(sizeType slot) const;
+  void CheckAlive(sizeType slot) const;
+  void MaybeCompact();
+
+  Vector<valueType> values_;
+  // Бит ячейки установлен, пока элемент жив
+  BitVector alive_;
+  sizeType dead_ = 0;
+  double threshold_ = kDefaultThreshold;
+};
+
+}  // namespace s21
+
+#include "s21_tombstone_vector.tpp"
+
+#endif  // SRC_TOMBSTONE_VECTOR_S21_TOMBSTONE_VECTOR_H_
@@ -0,0 +1,289 @@
+#ifndef SRC_TOMBSTONE_VECTOR_S21_TOMBSTONE_VECTOR_TPP_
+#define SRC_TOMBSTONE_VECTOR_S21_TOMBSTONE_VECTOR_TPP_
+
+namespace s21 {
+
+template <typename T>
+TombstoneVector<T>::TombstoneVector(Vector<valueType> values)
+    : values_(std::move(values)), alive_(values_.Size(), true) {}
+
+template <typename T>
+TombstoneVector<T>::TombstoneVector(
+    std::initializer_list<valueType> const &items)
+    : values_(items), alive_(values_.Size(), true) {}
+
+template <typename T>
+void TombstoneVector<T>::Swap(TombstoneVector &other) {
+  values_.Swap(other.values_);
+  alive_.Swap(other.alive_);
+  std::swap(dead_, other.dead_);
+  std::swap(threshold_, other.threshold_);
+}
+
+template <typename T>
+typename TombstoneVector<T>::reference TombstoneVector<T>::operator[](
+    sizeType slot) {
+  return values_.Data()[slot];
+}
+
+template <typename T>
+typename TombstoneVector<T>::constReference TombstoneVector<T>::operator[](
+    sizeType slot) const {
+  return values_.Data()[slot];
+}
+
+template <typename T>
+typename TombstoneVector<T>::reference TombstoneVector<T>::At(sizeType slot) {
+  CheckAlive(slot);
+  return values_.Data()[slot];
+}
+
+template <typename T>
+typename TombstoneVector<T>::constReference TombstoneVector<T>::At(
+    sizeType slot) const {
+  CheckAlive(slot);
+  return values_.Data()[slot];
+}
+
+template <typename T>
+bool TombstoneVector<T>::IsAlive(sizeType slot) const {
+  return slot < alive_.Size() && alive_.Test(slot);
+}
+
+template <typename T>
+typename TombstoneVector<T>::iterator TombstoneVector<T>::Begin() {
+  return iterator(this, FirstAlive());
+}
+
+template <typename T>
+typename TombstoneVector<T>::iterator TombstoneVector<T>::End() {
+  return iterator(this, Slots());
+}
+
+template <typename T>
+typename TombstoneVector<T>::constIterator TombstoneVector<T>::Begin() const {
+  return constIterator(this, FirstAlive());
+}
+
+template <typename T>
+typename TombstoneVector<T>::constIterator TombstoneVector<T>::End() const {
+  return constIterator(this, Slots());
+}
+
+template <typename T>
+template <typename Function>
+void TombstoneVector<T>::ForEach(Function fn) {
+  const BitVector::wordType *words = alive_.Data();
+  T *data = values_.Data();
+  for (sizeType word = 0; word < alive_.WordCount(); ++word) {
+    BitVector::wordType bits = words[word];
+    T *base = data + word * BitVector::kWordBits;
+    if (~bits == 0) {
+      for (sizeType i = 0; i < BitVector::kWordBits; ++i) fn(base[i]);
+      continue;
+    }
+    for (; bits; bits &= bits - 1) fn(base[__builtin_ctzll(bits)]);
+  }
+}
+
+template <typename T>
+template <typename Function>
+void TombstoneVector<T>::ForEach(Function fn) const {
+  const BitVector::wordType *words = alive_.Data();
+  const T *data = values_.Data();
+  for (sizeType word = 0; word < alive_.WordCount(); ++word) {
+    BitVector::wordType bits = words[word];
+    const T *base = data + word * BitVector::kWordBits;
+    if (~bits == 0) {
+      for (sizeType i = 0; i < BitVector::kWordBits; ++i) fn(base[i]);
+      continue;
+    }
+    for (; bits; bits &= bits - 1) fn(base[__builtin_ctzll(bits)]);
+  }
+}
+
+template <typename T>
+bool TombstoneVector<T>::Empty() const {
+  return Size() == 0;
+}
+
+template <typename T>
+typename TombstoneVector<T>::sizeType TombstoneVector<T>::Size() const {
+  return values_.Size() - dead_;
+}
+
+template <typename T>
+typename TombstoneVector<T>::sizeType TombstoneVector<T>::Slots() const {
+  return values_.Size();
+}
+
+template <typename T>
+typename TombstoneVector<T>::sizeType TombstoneVector<T>::DeadCount() const {
+  return dead_;
+}
+
+template <typename T>
+void TombstoneVector<T>::Reserve(sizeType size) {
+  values_.Reserve(size);
+  alive_.Reserve(size);
+}
+
+template <typename T>
+void TombstoneVector<T>::Clear() {
+  values_.Clear();
+  alive_.Clear();
+  dead_ = 0;
+}
+
+template <typename T>
+void TombstoneVector<T>::PushBack(constReference value) {
+  EmplaceBack(value);
+}
+
+template <typename T>
+void TombstoneVector<T>::PushBack(valueType &&value) {
+  EmplaceBack(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename TombstoneVector<T>::reference TombstoneVector<T>::EmplaceBack(
+    Args &&...args) {
+  // Сначала бит: если он не выделится, вектор значений не изменится
+  alive_.PushBack(true);
+  try {
+    return values_.EmplaceBack(std::forward<Args>(args)...);
+  } catch (...) {
+    alive_.PopBack();
+    throw;
+  }
+}
+
+template <typename T>
+bool TombstoneVector<T>::Erase(sizeType slot) {
+  if (slot >= Slots()) throw std::out_of_range("Index out of range");
+  if (!alive_.Test(slot)) return false;
+  alive_.Reset(slot);
+  ++dead_;
+  MaybeCompact();
+  return true;
+}
+
+template <typename T>
+template <typename Predicate>
+typename TombstoneVector<T>::sizeType TombstoneVector<T>::EraseIf(
+    Predicate pred) {
+  const BitVector::wordType *words = alive_.Data();
+  sizeType erased = 0;
+  for (sizeType word = 0; word < alive_.WordCount(); ++word) {
+    // Копия слова: Reset меняет карту, но не уже прочитанные биты
+    for (BitVector::wordType bits = words[word]; bits; bits &= bits - 1) {
+      sizeType slot = word * BitVector::kWordBits +
+                      static_cast<sizeType>(__builtin_ctzll(bits));
+      if (pred(values_.Data()[slot])) {
+        alive_.Reset(slot);
+        ++erased;
+      }
+    }
+  }
+  dead_ += erased;
+  MaybeCompact();
+  return erased;
+}
+
+template <typename T>
+void TombstoneVector<T>::SetCompactThreshold(double ratio) {
+  if (!(ratio >= 0)) {
+    throw std::invalid_argument("Compact threshold must be non-negative");
+  }
+  threshold_ = ratio;
+}
+
+template <typename T>
+double TombstoneVector<T>::CompactThreshold() const {
+  return threshold_;
+}
+
+/*
+ * Элемент, перемещение которого может бросить исключение, копируется.
+ * Если бросит и копия, карта живых приводится к тому, что уже сдвинуто:
+ * живые элементы до прерванного лежат в начале, их прежние ячейки
+ * помечаются удалёнными, остальные не тронуты.
+ */
+template <typename T>
+void TombstoneVector<T>::Compact() {
+  if (dead_ == 0) return;
+  const BitVector::wordType *words = alive_.Data();
+  T *data = values_.Data();
+  sizeType out = 0;
+  sizeType slot = 0;
+  try {
+    for (sizeType word = 0; word < alive_.WordCount(); ++word) {
+      BitVector::wordType bits = words[word];
+      sizeType base = word * BitVector::kWordBits;
+      // Пока удалённых не встретилось, элементы уже на своих местах
+      if (~bits == 0 && out == base) {
+        out += BitVector::kWordBits;
+        continue;
+      }
+      for (; bits; bits &= bits - 1) {
+        slot = base + static_cast<sizeType>(__builtin_ctzll(bits));
+        if (slot != out) {
+          if constexpr (std::is_nothrow_move_assignable_v<T> ||
+                        !std::is_copy_assignable_v<T>) {
+            data[out] = std::move(data[slot]);
+          } else {
+            data[out] = data[slot];
+          }
+        }
+        ++out;
+      }
+    }
+  } catch (...) {
+    for (sizeType i = 0; i < slot; ++i) alive_.Set(i, i < out);
+    dead_ = values_.Size() - alive_.Count();
+    throw;
+  }
+  values_.Erase(values_.Begin() + out, values_.End());
+  alive_.Resize(out);
+  alive_.SetAll();
+  dead_ = 0;
+}
+
+template <typename T>
+Vector<T> TombstoneVector<T>::Release() {
+  Compact();
+  Vector<T> result = std::move(values_);
+  Clear();
+  return result;
+}
+
+template <typename T>
+typename TombstoneVector<T>::sizeType TombstoneVector<T>::FirstAlive() const {
+  sizeType slot = alive_.FindFirst();
+  return slot == BitVector::kNpos ? Slots() : slot;
+}
+
+template <typename T>
+typename TombstoneVector<T>::sizeType TombstoneVector<T>::NextAlive(
+    sizeType slot) const {
+  sizeType next = alive_.FindNext(slot);
+  return next == BitVector::kNpos ? Slots() : next;
+}
+
+template <typename T>
+void TombstoneVector<T>::CheckAlive(sizeType slot) const {
+  if (!IsAlive(slot)) throw std::out_of_range("Index out of range");
+}
+
+template <typename T>
+void TombstoneVector<T>::MaybeCompact() {
+  if (static_cast<double>(dead_) >
+      threshold_ * static_cast<double>(Slots())) {
+    Compact();
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_TOMBSTONE_VECTOR_S21_TOMBSTONE_VECTOR_TPP_
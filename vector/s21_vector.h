@@ -1,12 +1,29 @@
 #ifndef SRC_VECTOR_S21_VECTOR_H_
 #define SRC_VECTOR_S21_VECTOR_H_
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "../memory/s21_aligned_allocator.h"
+#include "../memory/s21_allocator.h"
+#include "../memory/s21_buffer_ops.h"
+#include "../memory/s21_growth_policy.h"
+#include "../memory/s21_relocate.h"
+#include "../simd/s21_simd.h"
 
 namespace s21 {
 
-template <typename T>
+/*
+ * Growth задаёт рост ёмкости (GrowByDoubling, GrowByHalf, GrowByChunk<N>),
+ * Allocator - источник сырой памяти (HeapAllocator, MmapAllocator).
+ */
+template <typename T, typename Growth = GrowByDoubling,
+          typename Allocator = HeapAllocator<T>>
 class Vector {
  public:
   using valueType = T;
@@ -43,23 +60,40 @@ class Vector {
   constIterator Data() const;
   constIterator Begin() const;
   constIterator End() const;
-  bool Empty();
+  bool Empty() const;
 
-  sizeType Size();
+  sizeType Size() const;
 
-  sizeType MaxSize();
+  sizeType MaxSize() const;
 
   void Reserve(sizeType size);
 
-  sizeType Capacity();
+  sizeType Capacity() const;
 
   void ShrinkToFit();
   void Clear();
+  // Присваивает value всем элементам, размер не меняется
+  void Fill(constReference value);
 
   iterator Insert(iterator pos, constReference value);
-  void Erase(iterator pos);
+  iterator Insert(iterator pos, valueType &&value);
+  template <typename InputIt>
+  iterator Insert(iterator pos, InputIt first, InputIt last);
+  iterator Erase(iterator pos);
+  iterator Erase(iterator first, iterator last);
+
+  template <typename Predicate>
+  iterator RemoveIf(Predicate pred);
+  template <typename Predicate>
+  sizeType EraseIf(Predicate pred);
 
   void PushBack(constReference value);
+  void PushBack(valueType &&value);
+
+  template <typename... Args>
+  iterator Emplace(constIterator pos, Args &&...args);
+  template <typename... Args>
+  reference EmplaceBack(Args &&...args);
 
   void PopBack();
 
@@ -74,10 +108,21 @@ class Vector {
   size_t arr_capacity_;
   iterator arr_;
 
-  void ReallocMemory();
-  bool EnsureCapacity();
+  sizeType GrowCapacity(sizeType required) const;
+  void ReallocMemory(sizeType capacity);
+  void AdoptBlock(iterator tmp, sizeType capacity, sizeType count);
+
+  void AdoptMemory(sizeType capacity);
+  static sizeType PaddedCapacity(sizeType n);
+  static iterator Allocate(sizeType n);
+  static void Deallocate(iterator data, sizeType n);
 };
 
+// Вектор, у которого Data() выровнен на Alignment байт, а ёмкость кратна
+// ширине вектора в Alignment байт
+template <typename T, size_t Alignment = 64>
+using AlignedVector = Vector<T, GrowByDoubling, AlignedAllocator<T, Alignment>>;
+
 }  // namespace s21
 
 #include "s21_vector.tpp"
@@ -3,68 +3,75 @@
 
 namespace s21 {
 
-template <typename T>
-Vector<T>::Vector() : arr_size_(0), arr_capacity_(0), arr_(nullptr) {}
-
-template <typename T>
-Vector<T>::Vector(sizeType n) : arr_size_(n), arr_capacity_(n), arr_(nullptr) {
-  if (n > 0) arr_ = new valueType[arr_capacity_];
-}
-
-template <typename T>
-Vector<T>::Vector(std::initializer_list<valueType> const &items)
-    : arr_size_(items.size()), arr_capacity_(items.size()) {
-  arr_ = new valueType[arr_capacity_];
-  std::copy(items.begin(), items.end(), arr_);
-}
-
-template <typename T>
-Vector<T>::Vector(const Vector &v)
-    : arr_size_(v.arr_size_), arr_capacity_(v.arr_capacity_) {
-  arr_ = new valueType[arr_capacity_];
-  std::copy(v.Begin(), v.End(), arr_);
-}
-
-template <typename T>
-Vector<T>::Vector(Vector &&v) noexcept
+template <typename T, typename Growth, typename Allocator>
+Vector<T, Growth, Allocator>::Vector()
+    : arr_size_(0), arr_capacity_(0), arr_(nullptr) {}
+
+/*
+ * Конструкторы с элементами делегируют пустому: после него объект уже
+ * создан, и если конструктор элемента бросит исключение, деструктор
+ * освободит память. Созданные элементы разрушают сами uninitialized_*,
+ * а размер выставляется только после успешного создания всех элементов.
+ */
+template <typename T, typename Growth, typename Allocator>
+Vector<T, Growth, Allocator>::Vector(sizeType n) : Vector() {
+  AdoptMemory(PaddedCapacity(n));
+  std::uninitialized_value_construct_n(arr_, n);
+  arr_size_ = n;
+}
+
+template <typename T, typename Growth, typename Allocator>
+Vector<T, Growth, Allocator>::Vector(
+    std::initializer_list<valueType> const &items)
+    : Vector() {
+  AdoptMemory(PaddedCapacity(items.size()));
+  UninitializedCopy(items.begin(), items.end(), arr_);
+  arr_size_ = items.size();
+}
+
+template <typename T, typename Growth, typename Allocator>
+Vector<T, Growth, Allocator>::Vector(const Vector &v) : Vector() {
+  AdoptMemory(v.arr_capacity_);
+  UninitializedCopy(v.Begin(), v.End(), arr_);
+  arr_size_ = v.arr_size_;
+}
+
+template <typename T, typename Growth, typename Allocator>
+Vector<T, Growth, Allocator>::Vector(Vector &&v) noexcept
     : arr_size_(v.arr_size_), arr_capacity_(v.arr_capacity_), arr_(v.arr_) {
   v.arr_ = nullptr;
   v.arr_capacity_ = 0;
   v.arr_size_ = 0;
 }
 
-template <typename T>
-Vector<T>::~Vector() {
-  if (arr_ != nullptr) {
-    delete[] arr_;
-    arr_ = nullptr;
-  }
+template <typename T, typename Growth, typename Allocator>
+Vector<T, Growth, Allocator>::~Vector() {
+  DestroyRange(Begin(), End());
+  Deallocate(arr_, arr_capacity_);
+  arr_ = nullptr;
 }
 
-template <typename T>
-Vector<T> &Vector<T>::operator=(const Vector<T> &v) {
+template <typename T, typename Growth, typename Allocator>
+Vector<T, Growth, Allocator> &Vector<T, Growth, Allocator>::operator=(
+    const Vector &v) {
   if (this != &v) {
-    delete[] arr_;
-
-    arr_size_ = v.arr_size_;
-    arr_capacity_ = v.arr_capacity_;
-
-    arr_ = new valueType[arr_capacity_];
-
-    for (size_t i = 0; i < arr_size_; ++i) {
-      arr_[i] = v.arr_[i];
-    }
+    // Копия создаётся до освобождения старых элементов: при исключении
+    // вектор не меняется
+    Vector copy(v);
+    Swap(copy);
   }
   return *this;
 }
 
-template <typename T>
-Vector<T> &Vector<T>::operator=(Vector<T> &&v) noexcept {
+template <typename T, typename Growth, typename Allocator>
+Vector<T, Growth, Allocator> &Vector<T, Growth, Allocator>::operator=(
+    Vector &&v) noexcept {
   if (this != &v) {
-    delete[] arr_;
+    DestroyRange(Begin(), End());
+    Deallocate(arr_, arr_capacity_);
 
-    arr_size_ = std::move(v.arr_size_);
-    arr_capacity_ = std::move(v.arr_capacity_);
+    arr_size_ = v.arr_size_;
+    arr_capacity_ = v.arr_capacity_;
     arr_ = v.arr_;
 
     v.arr_ = nullptr;
@@ -74,15 +81,16 @@ Vector<T> &Vector<T>::operator=(Vector<T> &&v) noexcept {
   return *this;
 }
 
-template <typename T>
-void Vector<T>::Swap(Vector &other) {
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::Swap(Vector &other) {
   std::swap(arr_capacity_, other.arr_capacity_);
   std::swap(arr_size_, other.arr_size_);
   std::swap(arr_, other.arr_);
 }
 
-template <typename T>
-typename Vector<T>::reference Vector<T>::At(sizeType pos) {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::reference
+Vector<T, Growth, Allocator>::At(sizeType pos) {
   if (pos >= arr_size_)
     throw std::out_of_range(
         "vector::At(): index (which is " + std::to_string(pos) +
@@ -90,201 +98,352 @@ typename Vector<T>::reference Vector<T>::At(sizeType pos) {
   return arr_[pos];
 }
 
-template <typename T>
-typename Vector<T>::reference Vector<T>::operator[](sizeType pos) {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::reference
+Vector<T, Growth, Allocator>::operator[](sizeType pos) {
   return arr_[pos];
 }
 
-template <typename T>
-typename Vector<T>::constReference Vector<T>::Front() const {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::constReference
+Vector<T, Growth, Allocator>::Front() const {
   return *Begin();
 }
 
-template <typename T>
-typename Vector<T>::constReference Vector<T>::Back() const {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::constReference
+Vector<T, Growth, Allocator>::Back() const {
   return arr_[arr_size_ - 1];
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::Data() {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::Data() {
   return arr_;
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::Begin() {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::Begin() {
   return arr_;
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::End() {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::End() {
   return arr_ + arr_size_;
 }
 
-template <typename T>
-typename Vector<T>::constIterator Vector<T>::Data() const {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::constIterator
+Vector<T, Growth, Allocator>::Data() const {
   return arr_;
 }
 
-template <typename T>
-typename Vector<T>::constIterator Vector<T>::Begin() const {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::constIterator
+Vector<T, Growth, Allocator>::Begin() const {
   return arr_;
 }
 
-template <typename T>
-typename Vector<T>::constIterator Vector<T>::End() const {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::constIterator
+Vector<T, Growth, Allocator>::End() const {
   return arr_ + arr_size_;
 }
 
-template <typename T>
-bool Vector<T>::Empty() {
+template <typename T, typename Growth, typename Allocator>
+bool Vector<T, Growth, Allocator>::Empty() const {
   return arr_size_ == 0;
 }
 
-template <typename T>
-typename Vector<T>::sizeType Vector<T>::Size() {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::sizeType
+Vector<T, Growth, Allocator>::Size() const {
   return End() - Begin();
 }
 
-template <typename T>
-typename Vector<T>::sizeType Vector<T>::MaxSize() {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::sizeType
+Vector<T, Growth, Allocator>::MaxSize() const {
   return std::numeric_limits<sizeType>::max() / sizeof(valueType) / 2;
 }
 
-template <typename T>
-void Vector<T>::Reserve(sizeType size) {
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::Reserve(sizeType size) {
   if (size > MaxSize()) {
     throw std::length_error("Requested Size exceeds the maximum Size.");
   }
-  if (arr_capacity_ > size) {
+  if (arr_capacity_ >= size) {
     return;
   }
-
-  auto *tmp = new valueType[size];
-  for (size_t i = 0; i < arr_size_; ++i) {
-    tmp[i] = std::move(arr_[i]);
-  }
-  delete[] arr_;
-  arr_ = tmp;
-  arr_capacity_ = size;
+  ReallocMemory(PaddedCapacity(size));
 }
 
-template <typename T>
-typename Vector<T>::sizeType Vector<T>::Capacity() {
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::sizeType
+Vector<T, Growth, Allocator>::Capacity() const {
   return arr_capacity_;
 }
 
-template <typename T>
-void Vector<T>::ShrinkToFit() {
-  T *tmp = new valueType[arr_size_];
-  for (size_t i = 0; i < arr_size_; ++i) {
-    tmp[i] = std::move(arr_[i]);
-  }
-  delete[] arr_;
-  arr_ = tmp;
-  arr_capacity_ = arr_size_;
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::ShrinkToFit() {
+  sizeType capacity = PaddedCapacity(arr_size_);
+  if (arr_capacity_ != capacity) ReallocMemory(capacity);
 }
 
-template <typename T>
-void Vector<T>::Clear() {
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::Clear() {
+  DestroyRange(Begin(), End());
   arr_size_ = 0;
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::Insert(iterator pos,
-                                               constReference value) {
-  Vector<valueType> tmp(arr_size_ + 1);
-  sizeType i = 0, j = 0, position = pos - Begin();
-  while (i < arr_size_ + 1) {
-    if (i != position) {
-      tmp.arr_[i] = std::move(arr_[j++]);
-    } else {
-      tmp.arr_[i] = std::move(value);
-    }
-    ++i;
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::Fill(constReference value) {
+  if constexpr (simd::kHasKernels<T>) {
+    simd::Fill(Begin(), End(), value);
+  } else {
+    std::fill(Begin(), End(), value);
   }
+}
+
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::Insert(iterator pos, constReference value) {
+  return Emplace(pos, value);
+}
 
-  *this = std::move(tmp);
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::Insert(iterator pos, valueType &&value) {
+  return Emplace(pos, std::move(value));
+}
+
+template <typename T, typename Growth, typename Allocator>
+template <typename... Args>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::Emplace(constIterator pos, Args &&...args) {
+  sizeType position = pos - Begin();
+  if (position == arr_size_) {
+    EmplaceBack(std::forward<Args>(args)...);
+    return arr_ + position;
+  }
+  if (arr_size_ < arr_capacity_) {
+    EmplaceShifting(arr_, arr_size_, position, std::forward<Args>(args)...);
+    return arr_ + position;
+  }
+  sizeType capacity = GrowCapacity(arr_size_ + 1);
+  AdoptBlock(GrowAround<Allocator>(arr_, arr_size_, position, 1, capacity,
+                                   [&args...](iterator place) {
+                                     new (place) valueType(
+                                         std::forward<Args>(args)...);
+                                   }),
+             capacity, 1);
   return arr_ + position;
 }
 
-template <typename T>
-void Vector<T>::Erase(iterator pos) {
-  Vector<valueType> tmp(arr_size_ - 1);
-  sizeType i = 0, j = 0, position = pos - Begin();
-  while (i < arr_size_) {
-    if (i != position) {
-      tmp.arr_[j++] = arr_[i];
+/*
+ * Вставка диапазона сдвигает хвост один раз. Для однопроходных итераторов
+ * элементы дописываются в конец и поворачиваются на место. Диапазон не
+ * должен указывать внутрь самого вектора.
+ */
+template <typename T, typename Growth, typename Allocator>
+template <typename InputIt>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::Insert(iterator pos, InputIt first,
+                                     InputIt last) {
+  sizeType position = pos - Begin();
+  using Category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (!std::is_base_of_v<std::forward_iterator_tag, Category>) {
+    sizeType old_size = arr_size_;
+    for (; first != last; ++first) PushBack(*first);
+    std::rotate(Begin() + position, Begin() + old_size, End());
+    return arr_ + position;
+  } else {
+    sizeType count = std::distance(first, last);
+    if (count == 0) return pos;
+    if (arr_size_ + count > arr_capacity_) {
+      sizeType capacity = GrowCapacity(arr_size_ + count);
+      AdoptBlock(GrowAround<Allocator>(arr_, arr_size_, position, count,
+                                       capacity,
+                                       [first, last](iterator place) {
+                                         std::uninitialized_copy(first, last,
+                                                                 place);
+                                       }),
+                 capacity, count);
+    } else {
+      InsertShifting(arr_, arr_size_, position, first, last, count);
     }
-    ++i;
+    return arr_ + position;
   }
+}
 
-  *this = std::move(tmp);
-  tmp.arr_ = nullptr;
-  tmp.arr_size_ = 0;
-  tmp.arr_capacity_ = 0;
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::Erase(iterator pos) {
+  return Erase(pos, pos + 1);
 }
 
-template <typename T>
-void Vector<T>::PushBack(constReference value) {
-  ReallocMemory();
-  arr_[arr_size_++] = value;
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::Erase(iterator first, iterator last) {
+  if (first == last) return first;
+  arr_size_ = EraseShifting(first, last, End()) - Begin();
+  return first;
 }
 
-template <typename T>
-void Vector<T>::PopBack() {
-  arr_size_--;
+/*
+ * Сдвигает оставляемые элементы к началу за один проход и возвращает новый
+ * конец; элементы после него остаются в перемещённом состоянии до Erase
+ */
+template <typename T, typename Growth, typename Allocator>
+template <typename Predicate>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::RemoveIf(Predicate pred) {
+  return std::remove_if(Begin(), End(), pred);
 }
 
-template <typename T>
-template <typename... Args>
-typename Vector<T>::iterator Vector<T>::InsertMany(constIterator pos,
-                                                   Args &&...args) {
-  s21::Vector<valueType> tmp{std::forward<Args>(args)...};
+template <typename T, typename Growth, typename Allocator>
+template <typename Predicate>
+typename Vector<T, Growth, Allocator>::sizeType
+Vector<T, Growth, Allocator>::EraseIf(Predicate pred) {
+  sizeType old_size = arr_size_;
+  Erase(RemoveIf(pred), End());
+  return old_size - arr_size_;
+}
 
-  auto position = (iterator)pos;
-  for (sizeType i = 0; i < tmp.arr_size_; ++i) {
-    position = Insert(position, tmp[i]) + 1;
-  }
-  return position;
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::PushBack(constReference value) {
+  EmplaceBack(value);
 }
 
-template <typename T>
-template <typename... Args>
-void Vector<T>::InsertManyBack(Args &&...args) {
-  s21::Vector<valueType> tmp{std::forward<Args>(args)...};
-  iterator position = this->End();
-  for (sizeType i = 0; i < tmp.arr_size_; ++i) {
-    position = Insert(position, tmp[i]) + 1;
-  }
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::PushBack(valueType &&value) {
+  EmplaceBack(std::move(value));
 }
 
-template <typename T>
-bool Vector<T>::EnsureCapacity() {
+template <typename T, typename Growth, typename Allocator>
+template <typename... Args>
+typename Vector<T, Growth, Allocator>::reference
+Vector<T, Growth, Allocator>::EmplaceBack(Args &&...args) {
   if (arr_size_ == arr_capacity_) {
-    arr_capacity_ = arr_capacity_ ? arr_capacity_ * 2 : 1;
-
-    if (arr_capacity_ > MaxSize()) {
-      throw std::length_error("Requested Size exceeds the maximum Size.");
+    sizeType capacity = GrowCapacity(arr_size_ + 1);
+    if constexpr (CanReallocate<Allocator>::value &&
+                  IsTriviallyRelocatable<T>::value) {
+      // блок может переехать, поэтому значение создаётся до роста
+      valueType value(std::forward<Args>(args)...);
+      ReallocMemory(capacity);
+      new (End()) valueType(std::move(value));
+      return arr_[arr_size_++];
     }
-    return true;
+    AdoptBlock(GrowAround<Allocator>(arr_, arr_size_, arr_size_, 1, capacity,
+                                     [&args...](iterator place) {
+                                       new (place) valueType(
+                                           std::forward<Args>(args)...);
+                                     }),
+               capacity, 1);
+    return arr_[arr_size_ - 1];
   }
-  return false;
+  new (arr_ + arr_size_) valueType(std::forward<Args>(args)...);
+  return arr_[arr_size_++];
 }
 
-template <typename T>
-void Vector<T>::ReallocMemory() {
-  if (EnsureCapacity()) {
-    T *tmp = new valueType[arr_capacity_];
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::PopBack() {
+  --arr_size_;
+  DestroyRange(End(), End() + 1);
+}
+
+template <typename T, typename Growth, typename Allocator>
+template <typename... Args>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::InsertMany(constIterator pos, Args &&...args) {
+  Vector tmp{std::forward<Args>(args)...};
+  iterator position = Begin() + (pos - Begin());
+  return Insert(position, std::make_move_iterator(tmp.Begin()),
+                std::make_move_iterator(tmp.End())) +
+         tmp.arr_size_;
+}
 
-    for (sizeType i = 0; i < arr_size_; ++i) {
-      tmp[i] = std::move(arr_[i]);
+template <typename T, typename Growth, typename Allocator>
+template <typename... Args>
+void Vector<T, Growth, Allocator>::InsertManyBack(Args &&...args) {
+  InsertMany(End(), std::forward<Args>(args)...);
+}
+
+// Новая ёмкость по политике Growth, но не меньше required
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::sizeType
+Vector<T, Growth, Allocator>::GrowCapacity(sizeType required) const {
+  if (required > MaxSize()) {
+    throw std::length_error("Requested Size exceeds the maximum Size.");
+  }
+  return PaddedCapacity(
+      std::min(Growth::Next(arr_capacity_, required), MaxSize()));
+}
+
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::ReallocMemory(sizeType capacity) {
+  if constexpr (CanReallocate<Allocator>::value &&
+                IsTriviallyRelocatable<T>::value) {
+    // блок растёт на месте, без второй копии данных
+    if (arr_ && capacity) {
+      iterator data = Allocator::Reallocate(arr_, arr_capacity_, capacity);
+      if (data) {
+        arr_ = data;
+        arr_capacity_ = capacity;
+        return;
+      }
     }
+  }
+  AdoptBlock(GrowAround<Allocator>(arr_, arr_size_, arr_size_, 0, capacity,
+                                   [](iterator) {}),
+             capacity, 0);
+}
 
-    delete[] arr_;
-    arr_ = tmp;
+// Делает блок из GrowAround памятью вектора, в нём count новых элементов
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::AdoptBlock(iterator tmp, sizeType capacity,
+                                              sizeType count) {
+  Deallocate(arr_, arr_capacity_);
+  arr_ = tmp;
+  arr_capacity_ = capacity;
+  arr_size_ += count;
+}
+
+// Ёмкость, которую фактически вмещает блок распределителя под n элементов
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::sizeType
+Vector<T, Growth, Allocator>::PaddedCapacity(sizeType n) {
+  if constexpr (CanRoundCapacity<Allocator>::value) {
+    return Allocator::RoundCapacity(n);
+  } else {
+    return n;
   }
 }
 
+// Выделяет память пустому вектору без элементов
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::AdoptMemory(sizeType capacity) {
+  arr_ = Allocate(capacity);
+  arr_capacity_ = capacity;
+}
+
+/*
+ * Память выделяется без создания объектов: элементы живут только в
+ * [0, Size()), остаток ёмкости остаётся сырой памятью.
+ */
+template <typename T, typename Growth, typename Allocator>
+typename Vector<T, Growth, Allocator>::iterator
+Vector<T, Growth, Allocator>::Allocate(sizeType n) {
+  return Allocator::Allocate(n);
+}
+
+template <typename T, typename Growth, typename Allocator>
+void Vector<T, Growth, Allocator>::Deallocate(iterator data, sizeType n) {
+  Allocator::Deallocate(data, n);
+}
+
 }  // namespace s21
 
-#endif  // SRC_VECTOR_S21_VECTOR_TPP_
\ No newline at end of file
+#endif  // SRC_VECTOR_S21_VECTOR_TPP_